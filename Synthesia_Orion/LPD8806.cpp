@@ -65,6 +65,7 @@ a 'latch' anyway.
 */
 
 #include "LPD8806.h"
+#include "pins.h"
 
 /*****************************************************************************/
 
@@ -92,17 +93,22 @@ LPD8806::LPD8806(uint16_t n, uint8_t dpin, uint8_t cpin) {
 // command.  If using this constructor, MUST follow up with updateLength()
 // and updatePins() to establish the strip length and output pins!
 LPD8806::LPD8806(void) {
-  numLEDs = numBytes = 0;
+  numLEDs = numBytes = channelSum = 0;
+  scale   = 256;
   pixels  = NULL;
   begun   = false;
   enabled = false;
   updatePins(); // Must assume hardware SPI until pins are set
 }
 
+void LPD8806::powerUp(void) {
+  Pin<PIN_STRIP_ENABLE>::low();
+} // powerUp()
+
+
 void LPD8806::enable(boolean setBegun = false) {
-  // Power up the led strip.
-  digitalWrite(13, LOW);
-  delay(250);
+  // Power up the led strip. The caller gives the supply time to settle, see powerSequence.h.
+  Pin<PIN_STRIP_ENABLE>::low();
   
   enabled = true;
   
@@ -118,7 +124,7 @@ void LPD8806::disable(void) {
   }
   
   // ...then power off the led strip.
-  digitalWrite(13, HIGH);
+  Pin<PIN_STRIP_ENABLE>::high();
 
   // Finaly, set status flags to indicate the strip is powered down and disabled.
   begun   = false;
@@ -247,6 +253,8 @@ void LPD8806::startBitbang() {
 void LPD8806::updateLength(uint16_t n) {
   uint8_t latchBytes = (n + 31) / 32;
   if(pixels != NULL) free(pixels); // Free existing data (if any)
+  channelSum = 0;
+  scale      = 256;
   numLEDs    = n;
   n         *= 3; // 3 bytes per pixel
   numBytes   = n + latchBytes;
@@ -275,6 +283,16 @@ void LPD8806::show(void) {
   uint8_t  *ptr = pixels;
   uint16_t i    = numBytes;
 
+  // Scaled output goes through the slower per byte path. Latch bytes are 0 and stay 0.
+  if(scale < 256) {
+    while(i--) {
+      uint8_t b = *ptr++;
+      if(b) b = (((b & 0x7f) * scale) >> 8) | 0x80;
+      writeByte(b);
+    }
+    return;
+  }
+
   // This doesn't need to distinguish among individual pixel color
   // bytes vs. latch data, etc.  Everything is laid out in one big
   // flat buffer and issued the same regardless of purpose.
@@ -309,6 +327,78 @@ void LPD8806::show(void) {
   }
 }
 
+// Issue one byte the same way show() does.
+void LPD8806::writeByte(uint8_t b) {
+  if(hardwareSPI) {
+#if defined(__AVR_ATmega168__) || defined(__AVR_ATmega328P__) || defined (__AVR_ATmega328__) || defined(__AVR_ATmega8__) || (__AVR_ATmega1281__) || defined(__AVR_ATmega2561__) || defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+    while(!(SPSR & (1<<SPIF))); // Wait for prior byte out
+    SPDR = b;                   // Issue new byte
+#else
+    SPI.transfer(b);
+#endif
+  } else {
+    for(uint8_t bit=0x80; bit; bit >>= 1) {
+      if (dataport != 0) {
+        if(b & bit) *dataport |=  datapinmask;
+        else        *dataport &= ~datapinmask;
+        *clkport |=  clkpinmask;
+        *clkport &= ~clkpinmask;
+      } else {
+        if (b&bit) digitalWrite(datapin, HIGH);
+        else digitalWrite(datapin, LOW);
+        digitalWrite(clkpin, HIGH);
+        digitalWrite(clkpin, LOW);
+      }
+    }
+  }
+}
+
+// Like show(), but each pixel goes out as a blend of the same pixel in 'from'
+// (a buffer laid out like getPixels()) and this strip's own pixel. mix(n)
+// gives the weight of this strip's pixel n, 0 (all 'from') to 255. The blend
+// is done on the way out, so this strip's buffer is left as it was and no
+// second frame buffer is needed.
+void LPD8806::showBlended(const uint8_t *from, uint8_t (*mix)(uint16_t n)) {
+  if(! enabled)
+    return;
+
+  if(! begun)
+    return;
+
+  uint8_t *ptr = pixels;
+
+  for(uint16_t n = 0; n < numLEDs; n++) {
+    uint8_t m = mix(n);
+    for(uint8_t c = 0; c < 3; c++) {
+      uint8_t a = *from++ & 0x7f;
+      uint8_t b = *ptr++  & 0x7f;
+      uint8_t v = a + (((int16_t)(b - a) * m) >> 8);
+      if(scale < 256) v = (v * scale) >> 8;
+      writeByte(v | 0x80);
+    }
+  }
+
+  // Latch bytes
+  for(uint16_t i = numBytes - numLEDs * 3; i > 0; i--)
+    writeByte(*ptr++);
+}
+
+uint8_t *LPD8806::getPixels(void) {
+  return pixels;
+}
+
+uint16_t LPD8806::getChannelSum(void) {
+  return channelSum;
+}
+
+void LPD8806::setScale(uint16_t s) {
+  scale = s > 256 ? 256 : s;
+}
+
+uint16_t LPD8806::getScale(void) {
+  return scale;
+}
+
 // Convert separate R,G,B into combined 32-bit GRB color:
 uint32_t LPD8806::Color(byte r, byte g, byte b) {
   return ((uint32_t)(g | 0x80) << 16) |
@@ -320,6 +410,9 @@ uint32_t LPD8806::Color(byte r, byte g, byte b) {
 void LPD8806::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
   if(n < numLEDs) { // Arrays are 0-indexed, thus NOT '<='
     uint8_t *p = &pixels[n * 3];
+    // Swap the old values out of the running sum and the new ones in, so it never needs a pass of its own.
+    channelSum += (uint16_t)(g & 0x7f) + (r & 0x7f) + (b & 0x7f)
+                - (p[0] & 0x7f) - (p[1] & 0x7f) - (p[2] & 0x7f);
     *p++ = g | 0x80; // Strip color order is GRB,
     *p++ = r | 0x80; // not the more common RGB,
     *p++ = b | 0x80; // so the order here is intentional; don't "fix"
@@ -330,6 +423,8 @@ void LPD8806::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
 void LPD8806::setPixelColor(uint16_t n, uint32_t c) {
   if(n < numLEDs) { // Arrays are 0-indexed, thus NOT '<='
     uint8_t *p = &pixels[n * 3];
+    channelSum += (uint16_t)((c >> 16) & 0x7f) + ((c >> 8) & 0x7f) + (c & 0x7f)
+                - (p[0] & 0x7f) - (p[1] & 0x7f) - (p[2] & 0x7f);
     *p++ = (c >> 16) | 0x80;
     *p++ = (c >>  8) | 0x80;
     *p++ =  c        | 0x80;
@@ -20,12 +20,15 @@ class LPD8806 {
   void
     begin(void),
     show(void),
+    showBlended(const uint8_t *from, uint8_t (*mix)(uint16_t n)), // Show a per pixel blend of from and this strip
     setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b),
     setPixelColor(uint16_t n, uint32_t c),
     updatePins(uint8_t dpin, uint8_t cpin), // Change pins, configurable
     updatePins(void),                       // Change pins, hardware SPI
     updateLength(uint16_t n),               // Change strip length
-    enable(boolean setBegun),  // Power up, activate SPI
+    setScale(uint16_t s),                   // Scale every channel by s/256 as it is sent. 256 (the default) is off.
+    powerUp(void),             // Switch the strip supply on. Call enable() once it has settled.
+    enable(boolean setBegun),  // Power up, activate SPI. Does not wait for the supply.
     disable(void);             // Power down, disable SPI
     boolean isEnabled(void);   // 
     boolean isDisabled(void);  // 
@@ -34,12 +37,19 @@ class LPD8806 {
   uint32_t
     Color(byte, byte, byte),
     getPixelColor(uint16_t n);
+  uint8_t
+    *getPixels(void);          // Raw pixel bytes, GRB with the high bit set, 3 per pixel. Do not write through this.
+  uint16_t
+    getChannelSum(void),       // Sum of every channel of every pixel, 0-127 each. Kept up to date by setPixelColor().
+    getScale(void);
 
  private:
 
   uint16_t
     numLEDs,    // Number of RGB LEDs in strip
-    numBytes;   // Size of 'pixels' buffer below
+    numBytes,   // Size of 'pixels' buffer below
+    channelSum, // Sum of all color values (7 bits each) in 'pixels'
+    scale;      // Output scale, 256 = full
   uint8_t
     *pixels,    // Holds LED color values (3 bytes each) + latch
     clkpin    , datapin,     // Clock & data pin numbers
@@ -48,7 +58,8 @@ class LPD8806 {
     *clkport  , *dataport;   // Clock & data PORT registers
   void
     startBitbang(void),
-    startSPI(void);
+    startSPI(void),
+    writeByte(uint8_t b);
   boolean
     hardwareSPI, // If 'true', using hardware SPI
     begun,       // If 'true', begin() method was previously invoked
@@ -56,4 +67,4 @@ class LPD8806 {
 };
 
 #endif
-
+
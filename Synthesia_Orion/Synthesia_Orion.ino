@@ -1,25 +1,143 @@
 #include <SPI.h>
-#include <avr/sleep.h>
-#include "PinChangeInt.h"
 #include "pins.h"
 #include "batteryStatus.h"
 #include "orion.h"
+#include "scheduler.h"
+#include "timeBase.h"
+#include "transition.h"
+#include "energyProfile.h"
+#include "telemetryLog.h"
+#include "buttonEvents.h"
+#include "powerSequence.h"
+#include "settings.h"
+#include "frameSync.h"
 
-boolean poweredOn = false;
+volatile boolean poweredOn = false;
 
 //
 void togglePower(void) 
 {
-  noInterrupts();
+  // The power task picks this up on its next pass, so there is nothing else to do inside the interrupt.
   poweredOn = !poweredOn;
-  
-  if(poweredOn)
+  notePowerPress();
+} // togglePower()
+
+
+// Tasks. Each returns true if it did any work.
+boolean powerTask(void)
+{
+  return updatePowerSequence(poweredOn);
+} // powerTask()
+
+
+boolean inputTask(void)
+{
+  if(!poweredOn)
+    return false;
+  if(updateControls())
+    return true;
+
+  // A button still down needs looking at again for holds and its release.
+  if(buttonsActive())
+    wakeBy(timeMicros() + BUTTON_POLL_MS * 1000UL);
+  return false;
+} // inputTask()
+
+
+boolean renderTask(void)
+{
+  if(!poweredOn)
+    return false;
+  if(renderFrame())
+    return true;
+
+  // No step due yet. Let the scheduler sleep until there is.
+  wakeBy(nextFrameDue());
+  return false;
+} // renderTask()
+
+
+boolean transmitTask(void)
+{
+  if(!poweredOn || !stripReady())
+    return false;
+  if(showFrame())
   {
-    updateBatteryStatus(poweredOn);
-    updateOrion();
+    notePowerFrameShown();
+    return true;
   }
-  interrupts();
-} // togglePower()
+
+  if(transitionActive())
+    wakeBy(nextTransitionFrame());
+  return false;
+} // transmitTask()
+
+
+// Frames from a host over USB serial. Also picks up the telemetry dump request, so it runs even when off.
+boolean streamTask(void)
+{
+  return receiveFrame(poweredOn);
+} // streamTask()
+
+
+// Keeps the animation in step with the other units, see frameSync.h.
+boolean syncTask(void)
+{
+  return updateFrameSync(poweredOn);
+} // syncTask()
+
+
+boolean batteryTask(void)
+{
+  updateBatteryStatus(poweredOn);
+  return true;
+} // batteryTask()
+
+
+boolean telemetryTask(void)
+{
+  updateTaskLoads();
+  reportEnergyProfile();
+  updateTelemetryLog(poweredOn);
+  updateSettings();
+  return true;
+} // telemetryTask()
+
+
+boolean logTask(void)
+{
+  // Settings first: switching off waits for them.
+  if(writeSettings() || writeTelemetryLog())
+    return true;
+
+  // The EEPROM is still busy with the last byte, which takes 3.4 ms.
+  if(settingsPending() || telemetryLogPending())
+    wakeBy(timeMicros() + 3400);
+  return false;
+} // logTask()
+
+
+// Host frames and sync beacons come in through the core's serial interrupts, which cannot call wakeTasks().
+boolean inputWaiting(void)
+{
+  return Serial.available() || Serial1.available();
+} // inputWaiting()
+
+
+// Power and buttons first, then getting a frame out, taking in host frames and sync beacons, then drawing the next one.
+// The battery light, the load accounting and the telemetry log can wait.
+Task tasks[] = {
+  //   task           period                 priority  deadline
+  TASK(powerTask,     0,                     0,        0),
+  TASK(inputTask,     0,                     0,        0),
+  TASK(transmitTask,  0,                     1,        0),
+  TASK(streamTask,    0,                     1,        0),
+  TASK(syncTask,      0,                     1,        0),
+  TASK(renderTask,    0,                     2,        0),
+  TASK(batteryTask,   BATTERY_UPDATE_PERIOD, 3,        BATTERY_UPDATE_PERIOD / 2),
+  TASK(telemetryTask, 1000,                  4,        500),
+  TASK(logTask,       0,                     4,        0)
+};
 
 
 void setup() 
@@ -34,47 +152,24 @@ void setup()
   
   // Attach button interrupts
   interrupts();
-  PCintPort::attachInterrupt(PIN_BUTTON_MODE, &stepMode, FALLING);
-  PCintPort::attachInterrupt(PIN_BUTTON_SPEED, &stepSpeed, FALLING);
+  startButtonInterrupts();
   attachInterrupt(INT1, &stepBrightness, FALLING);
   attachInterrupt(INT0, &togglePower, FALLING);
 // Does not work. ???
 //  attachInterrupt(PIN_BUTTON_LEVEL, &stepBrightness, FALLING);
 //  attachInterrupt(PIN_BUTTON_POWER, &togglePower, FALLING);
   
-  setupBatteryStatusInterrupt();  
+  startTimeBase();
   setupOrion();
+  startEnergyProfile();
+  startTelemetryLog();
+  startFrameSync();
+  startTasks(tasks, sizeof(tasks) / sizeof(tasks[0]), inputWaiting);
 } // setup()
 
 
 void loop() {
-
-  updateBatteryStatus(poweredOn);
-
-  // Start up the device
-  if(poweredOn && isDisabled())
-    enable(true);
-  
-  // Shut down the device
-  if(!poweredOn && isEnabled())
-  {
-    disable();
-    // Ensure that the status LED is off
-    forceStatusLightOff();
-    // Define sleep type
-    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
-   // Attach the awake interrupt to the power button
-   //attachInterrupt(INT0,sleepHandler, FALLING); 
-   sleep_enable();
-   sleep_mode();  //sleep now
-   sleep_disable(); //fully awake now 
-  }
-
-  // Update the LEDs if the device is enabled
-  if(poweredOn)
-  {
-    updateOrion();
-  }
-
+  // Powering up and down is the power task's job, see powerSequence.h.
+  runTasks();
 }
 
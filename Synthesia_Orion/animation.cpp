@@ -0,0 +1,69 @@
+#include "animation.h"
+
+
+static uint16_t animationWord(const prog_uchar *p) {
+  return pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+} // animationWord()
+
+
+void startAnimation(AnimationPlayer *player, const prog_uchar *data) {
+  player->data = NULL;
+  if(pgm_read_byte(data) != 'O' || pgm_read_byte(data + 1) != 'A' || pgm_read_byte(data + 2) != ANIMATION_VERSION)
+    return;
+
+  player->data = data;
+  player->next = data + ANIMATION_HEADER_SIZE;
+  player->frame = 0;
+} // startAnimation()
+
+
+boolean decodeAnimationFrame(AnimationPlayer *player, uint8_t *pixels, uint16_t size) {
+  if(!player->data)
+    return false;
+
+  const prog_uchar *src = player->next;
+  uint16_t total = animationWord(player->data + 3) * 3;  // Bytes in the frame
+  uint16_t limit = size < total ? size : total;          // Bytes that land in pixels
+
+  boolean key = pgm_read_byte(src++) & ANIMATION_KEY;
+  uint16_t i = 0;
+
+  while(i < total)
+  {
+    uint8_t op = pgm_read_byte(src++);
+    uint8_t n = (op & 0x7F) + 1;
+    boolean repeat = op & 0x80;
+    uint8_t value = repeat ? pgm_read_byte(src++) : 0;
+
+    // Bytes of this run that land in the buffer.
+    uint8_t writable = i >= limit ? 0 : (limit - i < n ? limit - i : n);
+
+    if(repeat && !key && value == 0)
+    {
+      // Unchanged since the last frame.
+    } else {
+      uint8_t *p = pixels + i;
+      for(uint8_t k = 0; k < writable; k++)
+      {
+        if(!repeat)
+          value = pgm_read_byte(src + k);
+        *p = key ? value : *p ^ value;
+        p++;
+      }
+    }
+
+    if(!repeat)
+      src += n;
+    i += n;
+  }
+
+  if(++player->frame >= animationWord(player->data + 5))
+  {
+    player->frame = 0;
+    src = player->data + ANIMATION_HEADER_SIZE;
+  }
+  player->next = src;
+  return true;
+} // decodeAnimationFrame()
+
+// End of file.
@@ -0,0 +1,49 @@
+#ifndef __SYNTHESIA_ANIMATION_H
+#define __SYNTHESIA_ANIMATION_H
+
+#include <Arduino.h>
+
+// Compressed animations in flash, made on a PC with tools/animation_encode.py and played back by playback().
+//
+// Layout, all in PROGMEM:
+//   'O' 'A' <version> <pixels low> <pixels high> <frames low> <frames high> <ms per frame>
+//   (the rate the animation was made for; playback() plays one frame per animation step, so the speed setting
+//   scales it like any other mode, and at speed 1 its framePeriod in modeList.h should match)
+//   then each frame: <ANIMATION_KEY or 0> <ops...>
+//
+// A frame covers the 3 strip bytes per pixel (7 bit, GRB, as the LPD8806 takes them) with a run of ops:
+//   0x00-0x7F  literal: n+1 values follow
+//   0x80-0xFF  repeat: one value follows, used for (n & 0x7F)+1 bytes
+// A key frame stores the values. Any other frame stores them XORed with the frame before, so unchanged bytes are
+// long repeats of 0, which the decoder skips without touching. The first frame is always a key frame, and
+// playback loops back to it after the last.
+//
+// decodeAnimationFrame() decodes into a frame buffer the player owns, one pass over the frame's ops. The deltas
+// need the frame before exactly as decoded, so nothing else may write to it; playback() copies it to the strip at
+// the brightness setting. The cost follows the bytes that change, and is never more than one write per byte.
+// An animation made for more pixels than the buffer holds is clipped.
+//
+// Decode cost, counted from the loop rather than measured (no hardware here): about 25 cycles per op, 13 per
+// literal byte, 10 per byte of a changed repeat, and nothing per byte of an unchanged one. The comet demo's
+// frames are all key frames of 3 to 5 ops, about 22 literal bytes and 74 repeated: about 1100 cycles, 0.07 ms.
+// playback()'s copy to the strip at the brightness setting then costs about 100 cycles a pixel, 3200 at 32
+// pixels, and is the larger part.
+
+#define ANIMATION_VERSION     1
+#define ANIMATION_HEADER_SIZE 8
+#define ANIMATION_KEY         1
+
+struct AnimationPlayer {
+  const prog_uchar *data;
+  const prog_uchar *next;  // The next frame's flag byte
+  uint16_t          frame; // Its number
+};
+
+void startAnimation(AnimationPlayer *player, const prog_uchar *data); // A bad header leaves nothing to play
+// Decode the next frame into pixels, size bytes of 7 bit GRB, which hold the frame before. Returns false if
+// there is nothing to play.
+boolean decodeAnimationFrame(AnimationPlayer *player, uint8_t *pixels, uint16_t size);
+
+#endif
+
+// End of file.
@@ -0,0 +1,181 @@
+#include "animationClock.h"
+#include "orion.h"
+#include "timeBase.h"
+#include "frameSync.h"
+
+extern int mode, syspeed; // orion.cpp
+
+int animationStep; // Used for incrementing animations (0-384)
+int frameStep;     // Used to increment frame counts.
+int stepsElapsed;  // Whole animation steps since the previous frame. 1 unless frames are being dropped.
+boolean animationCycleStart; // True on the first frame of each animationStep cycle.
+boolean frameCycleStart;     // True on the first frame of each frameStep cycle.
+uint16_t animationPhase;     // Position in the animationStep cycle, 0-65535 for one full cycle.
+
+// Animation clock in 16.16 fixed point. The high word is the phase through one cycle of animationStep (385 steps).
+// It advances with elapsed time. frameStep is not a clock of its own: it counts the same steps round its
+// PIXEL_COUNT+1, so both move together and a frame is only drawn when a step has actually passed.
+static uint32_t animationClock;
+static uint32_t animationCycles; // Times animationClock has come round since the last reset
+
+// Step period, in quarter milliseconds per millisecond of the mode's frame period, for each speed setting.
+// Speed n steps every framePeriod*n ms (1000/(framePeriod*n) Hz). Speed 0 is twice as fast as speed 1.
+PROGMEM prog_uchar __speedScale[NUMBER_SPEED_SETTINGS + 1] = { 2, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40 };
+
+// Never step faster than this. It is about the rate the fastest modes could actually render at 32 pixels
+// when they were frame locked, so speed 0 looks the way it always did.
+#define MIN_STEP_PERIOD_US 2000UL
+// A stall longer than this (a blocking button handler, power up) does not fast forward the animation.
+#define MAX_ELAPSED_US   250000UL
+
+static unsigned long previousMicros; // timeMicros() when the clock was last advanced
+static uint32_t animationRate;       // Clock units per microsecond
+static boolean clockRestarted;       // Set by a reset or a jump until the frame for the new step is drawn
+
+// Current step period, which is also the time budget for drawing and showing one frame.
+static uint32_t stepPeriodUs = MIN_STEP_PERIOD_US;
+
+
+// Restart animationStep and frameStep from 0, as on a mode change. The next call to advanceAnimationClock()
+// draws step 0.
+void resetAnimationClock()
+{
+  animationClock = 0;
+  animationCycles = 0;
+  animationPhase = 0;
+  animationStep = frameStep = 0;
+  stepsElapsed = 0;
+  animationCycleStart = frameCycleStart = true;
+  clockRestarted = true;
+  previousMicros = timeMicros();
+} // resetAnimationClock()
+
+
+// animationStep for a clock value.
+static int clockStep(uint32_t clock)
+{
+  return ((clock >> 16) * 385) >> 16;
+} // clockStep()
+
+
+// Advance the animation clock by the time since the last call, at the rate set by the mode's frame period
+// and the speed setting. Updates animationStep, frameStep and stepsElapsed.
+// Returns true if at least one whole step has passed, i.e. a new frame is due. stepsElapsed is then at least 1:
+// the frame after a reset counts the step it enters.
+boolean advanceAnimationClock()
+{
+  static int rateMode = -1, rateSpeed = -1;
+
+  unsigned long currentMicros = timeMicros();
+  unsigned long elapsed = currentMicros - previousMicros;
+  if(elapsed > MAX_ELAPSED_US)
+    elapsed = MAX_ELAPSED_US;
+  // A unit following another's clock runs slightly fast or slow to stay in step (see frameSync.h).
+  elapsed += syncCorrection(elapsed);
+
+  // The rate only changes with the mode or speed, so the division is not done every call.
+  if(rateMode != mode || rateSpeed != syspeed)
+  {
+    stepPeriodUs = (uint32_t)modeFramePeriod(mode) * 250 * pgm_read_byte(&__speedScale[syspeed]);
+    if(stepPeriodUs < MIN_STEP_PERIOD_US)
+      stepPeriodUs = MIN_STEP_PERIOD_US;
+    animationRate = (0xFFFFFFFFUL / 385) / stepPeriodUs;
+    rateMode  = mode;
+    rateSpeed = syspeed;
+  }
+
+  // MAX_ELAPSED_US at the fastest rate is well short of one cycle, so the clock wraps at most once.
+  uint32_t nextAnimationClock = animationClock + elapsed * animationRate;
+  int steps = clockStep(nextAnimationClock) - animationStep;
+  if(steps < 0)
+    steps += 385;
+
+  // Until a whole step has passed, leave the clock alone and let the time keep adding up.
+  if(steps == 0 && !clockRestarted)
+    return false;
+
+  previousMicros = currentMicros;
+  syncCorrectionUsed();
+
+  if(nextAnimationClock < animationClock)
+  {
+    animationCycles++;
+    animationCycleStart = true;
+  }
+  frameStep += steps;
+  if(frameStep >= PIXEL_COUNT + 1)
+  {
+    frameStep %= PIXEL_COUNT + 1;
+    frameCycleStart = true;
+  }
+
+  stepsElapsed   = clockRestarted ? steps + 1 : steps;
+  clockRestarted = false;
+  animationClock = nextAnimationClock;
+  animationPhase = animationClock >> 16;
+  animationStep  = clockStep(animationClock);
+  return true;
+} // advanceAnimationClock()
+
+
+// The animation clock and its cycle count as they will be (or were) at timeMicros() t, between steps.
+void readAnimationClocks(unsigned long t, uint32_t *animation, uint32_t *cycles)
+{
+  long elapsed = (long)(t - previousMicros);
+  elapsed += syncTrim(elapsed);
+  *animation = animationClock + (uint32_t)elapsed * animationRate;
+  *cycles    = animationCycles;
+  if(elapsed >= 0 && *animation < animationClock)
+    (*cycles)++;
+  if(elapsed < 0 && *animation > animationClock)
+    (*cycles)--;
+} // readAnimationClocks()
+
+
+// Set the clock so that at timeMicros() t it reads animation after cycles whole cycles, e.g. to another
+// unit's. frameStep follows from the total steps. The next call to advanceAnimationClock() draws a frame.
+void setAnimationClocks(unsigned long t, uint32_t animation, uint32_t cycles)
+{
+  uint32_t now, nowCycles;
+  readAnimationClocks(t, &now, &nowCycles);
+  animationClock += animation - now;
+
+  // With the count at 0, reading the clock at t again gives the wraps between the two: 1, 0 or -1.
+  animationCycles = 0;
+  readAnimationClocks(t, &now, &nowCycles);
+  animationCycles = cycles - nowCycles;
+
+  animationPhase = animationClock >> 16;
+  animationStep  = clockStep(animationClock);
+  // The total step count, cycles * 385 + animationStep, taken round frameStep's cycle without overflowing.
+  frameStep = ((animationCycles % (PIXEL_COUNT + 1)) * 385 + animationStep) % (PIXEL_COUNT + 1);
+  animationCycleStart = frameCycleStart = true;
+  clockRestarted = true;
+} // setAnimationClocks()
+
+
+// Animation clock units per microsecond at the current mode and speed, or 0 before the first step.
+uint32_t animationClockRate()
+{
+  return animationRate;
+} // animationClockRate()
+
+
+uint32_t animationStepPeriod()
+{
+  return stepPeriodUs;
+} // animationStepPeriod()
+
+
+// The timeMicros() at which advanceAnimationClock() will next return true.
+unsigned long nextFrameDue()
+{
+  if(clockRestarted || !animationRate)
+    return timeMicros();
+
+  // Lowest phase that maps to the next step. For the last step it comes out as 65536, which wraps round to 0.
+  uint32_t target = (uint32_t)(((uint32_t)(animationStep + 1) * 65536 + 384) / 385) << 16;
+  return previousMicros + (target - animationClock) / animationRate + 1;
+} // nextFrameDue()
+
+// End of file.
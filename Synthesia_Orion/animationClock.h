@@ -0,0 +1,29 @@
+#ifndef __SYNTHESIA_ANIMATION_CLOCK_H
+#define __SYNTHESIA_ANIMATION_CLOCK_H
+
+#include <Arduino.h>
+
+// The animation clock behind animationStep and frameStep (see Animation timing in orion.h).
+//
+// A 16.16 phase accumulator advanced by elapsed timeMicros() times a rate set by the mode's frame period and the
+// speed setting. Kept apart from the modes so that frame sync (frameSync.h) and its host check can build against
+// it alone: it needs only the time base, mode and syspeed, and modeFramePeriod().
+
+extern int animationStep;            // 0-384
+extern int frameStep;                // 0-PIXEL_COUNT, moved on by the same steps as animationStep
+extern int stepsElapsed;             // Whole steps since the previous frame
+extern boolean animationCycleStart;  // True on the first frame of each animationStep cycle
+extern boolean frameCycleStart;      // True on the first frame of each frameStep cycle
+extern uint16_t animationPhase;      // Position in the animationStep cycle, 0-65535 for one full cycle
+
+void resetAnimationClock(void);
+boolean advanceAnimationClock(void);
+void readAnimationClocks(unsigned long t, uint32_t *animation, uint32_t *cycles);
+void setAnimationClocks(unsigned long t, uint32_t animation, uint32_t cycles);
+uint32_t animationClockRate(void);
+uint32_t animationStepPeriod(void);  // Microseconds per step, the time budget for one frame
+unsigned long nextFrameDue(void);
+
+#endif
+
+// End of file.
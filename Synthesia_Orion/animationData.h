@@ -0,0 +1,125 @@
+// Generated by tools/animation_encode.py from --demo comet --pixels 32 --frames 64. Do not edit.
+// 1797 bytes. Played by playback(), see animation.h.
+
+#ifndef __SYNTHESIA_ANIMATION_DATA_H
+#define __SYNTHESIA_ANIMATION_DATA_H
+
+PROGMEM prog_uchar __animation[] = {
+  0x4F, 0x41, 0x01, 0x20, 0x00, 0x40, 0x00, 0x14, 0x01, 0x02, 0x33, 0x7F, 0x33, 0xC8, 0x00, 0x13,
+  0x01, 0x00, 0x03, 0x07, 0x03, 0x07, 0x11, 0x07, 0x0C, 0x1F, 0x0C, 0x13, 0x31, 0x13, 0x1C, 0x47,
+  0x1C, 0x27, 0x61, 0x27, 0x01, 0x02, 0x33, 0x70, 0x2C, 0xCA, 0x00, 0x11, 0x02, 0x04, 0x01, 0x05,
+  0x0C, 0x04, 0x0B, 0x18, 0x09, 0x12, 0x28, 0x10, 0x1B, 0x3C, 0x18, 0x26, 0x54, 0x21, 0x01, 0x05,
+  0x32, 0x61, 0x27, 0x41, 0x7F, 0x33, 0xC7, 0x00, 0x11, 0x01, 0x01, 0x00, 0x04, 0x07, 0x03, 0x09,
+  0x11, 0x07, 0x10, 0x1F, 0x0C, 0x19, 0x31, 0x13, 0x24, 0x47, 0x1C, 0x01, 0x05, 0x2F, 0x54, 0x21,
+  0x3F, 0x70, 0x2C, 0xCA, 0x00, 0x0E, 0x02, 0x04, 0x01, 0x07, 0x0C, 0x04, 0x0D, 0x18, 0x09, 0x16,
+  0x28, 0x10, 0x22, 0x3C, 0x18, 0x01, 0x08, 0x2C, 0x47, 0x1C, 0x3D, 0x61, 0x27, 0x4F, 0x7F, 0x33,
+  0xC7, 0x00, 0x0E, 0x01, 0x01, 0x00, 0x04, 0x07, 0x03, 0x0B, 0x11, 0x07, 0x13, 0x1F, 0x0C, 0x1F,
+  0x31, 0x13, 0x01, 0x08, 0x29, 0x3C, 0x18, 0x39, 0x54, 0x21, 0x4C, 0x70, 0x2C, 0xCA, 0x00, 0x0B,
+  0x03, 0x04, 0x01, 0x08, 0x0C, 0x04, 0x10, 0x18, 0x09, 0x1B, 0x28, 0x10, 0x01, 0x0B, 0x24, 0x31,
+  0x13, 0x34, 0x47, 0x1C, 0x47, 0x61, 0x27, 0x5E, 0x7F, 0x33, 0xC7, 0x00, 0x0B, 0x01, 0x01, 0x00,
+  0x05, 0x07, 0x03, 0x0D, 0x11, 0x07, 0x17, 0x1F, 0x0C, 0x01, 0x0B, 0x20, 0x28, 0x10, 0x2F, 0x3C,
+  0x18, 0x42, 0x54, 0x21, 0x58, 0x70, 0x2C, 0xCA, 0x00, 0x08, 0x03, 0x04, 0x01, 0x09, 0x0C, 0x04,
+  0x13, 0x18, 0x09, 0x01, 0x0E, 0x1B, 0x1F, 0x0C, 0x2A, 0x31, 0x13, 0x3C, 0x47, 0x1C, 0x52, 0x61,
+  0x27, 0x6C, 0x7F, 0x33, 0xC7, 0x00, 0x08, 0x01, 0x01, 0x00, 0x06, 0x07, 0x03, 0x0F, 0x11, 0x07,
+  0x01, 0x0E, 0x16, 0x18, 0x09, 0x24, 0x28, 0x10, 0x36, 0x3C, 0x18, 0x4C, 0x54, 0x21, 0x65, 0x70,
+  0x2C, 0xCA, 0x00, 0x05, 0x04, 0x04, 0x01, 0x0B, 0x0C, 0x04, 0x01, 0x11, 0x11, 0x11, 0x07, 0x1E,
+  0x1F, 0x0C, 0x2F, 0x31, 0x13, 0x45, 0x47, 0x1C, 0x5D, 0x61, 0x27, 0x7A, 0x7F, 0x33, 0xC7, 0x00,
+  0x05, 0x01, 0x01, 0x00, 0x07, 0x07, 0x03, 0x01, 0x11, 0x0C, 0x0C, 0x04, 0x18, 0x17, 0x09, 0x28,
+  0x27, 0x10, 0x3C, 0x3B, 0x18, 0x54, 0x52, 0x21, 0x70, 0x6D, 0x2C, 0xCA, 0x00, 0x02, 0x04, 0x04,
+  0x01, 0x01, 0x14, 0x07, 0x07, 0x03, 0x11, 0x10, 0x07, 0x1F, 0x1D, 0x0C, 0x31, 0x2E, 0x13, 0x47,
+  0x42, 0x1C, 0x61, 0x5A, 0x27, 0x7F, 0x75, 0x33, 0xC7, 0x00, 0x02, 0x01, 0x01, 0x00, 0x01, 0x14,
+  0x04, 0x03, 0x01, 0x0C, 0x0A, 0x04, 0x18, 0x15, 0x09, 0x28, 0x23, 0x10, 0x3C, 0x34, 0x18, 0x54,
+  0x49, 0x21, 0x70, 0x61, 0x2C, 0xCA, 0x00, 0x01, 0x17, 0x01, 0x01, 0x00, 0x07, 0x06, 0x03, 0x11,
+  0x0E, 0x07, 0x1F, 0x19, 0x0C, 0x31, 0x28, 0x13, 0x47, 0x3A, 0x1C, 0x61, 0x4F, 0x27, 0x7F, 0x67,
+  0x33, 0xC7, 0x00, 0x01, 0x82, 0x00, 0x14, 0x04, 0x03, 0x01, 0x0C, 0x09, 0x04, 0x18, 0x12, 0x09,
+  0x28, 0x1E, 0x10, 0x3C, 0x2D, 0x18, 0x54, 0x3F, 0x21, 0x70, 0x54, 0x2C, 0xC7, 0x00, 0x01, 0x82,
+  0x00, 0x17, 0x01, 0x01, 0x00, 0x07, 0x05, 0x03, 0x11, 0x0C, 0x07, 0x1F, 0x16, 0x0C, 0x31, 0x22,
+  0x13, 0x47, 0x32, 0x1C, 0x61, 0x44, 0x27, 0x7F, 0x59, 0x33, 0xC4, 0x00, 0x01, 0x85, 0x00, 0x14,
+  0x04, 0x02, 0x01, 0x0C, 0x08, 0x04, 0x18, 0x0F, 0x09, 0x28, 0x19, 0x10, 0x3C, 0x26, 0x18, 0x54,
+  0x36, 0x21, 0x70, 0x48, 0x2C, 0xC4, 0x00, 0x01, 0x85, 0x00, 0x17, 0x01, 0x01, 0x00, 0x07, 0x04,
+  0x03, 0x11, 0x0A, 0x07, 0x1F, 0x12, 0x0C, 0x31, 0x1D, 0x13, 0x47, 0x2A, 0x1C, 0x61, 0x39, 0x27,
+  0x7F, 0x4A, 0x33, 0xC1, 0x00, 0x01, 0x88, 0x00, 0x14, 0x04, 0x02, 0x01, 0x0C, 0x06, 0x04, 0x18,
+  0x0C, 0x09, 0x28, 0x15, 0x10, 0x3C, 0x20, 0x18, 0x54, 0x2C, 0x21, 0x70, 0x3B, 0x2C, 0xC1, 0x00,
+  0x01, 0x88, 0x00, 0x17, 0x01, 0x00, 0x00, 0x07, 0x03, 0x03, 0x11, 0x08, 0x07, 0x1F, 0x0F, 0x0C,
+  0x31, 0x17, 0x13, 0x47, 0x22, 0x1C, 0x61, 0x2E, 0x27, 0x7F, 0x3C, 0x33, 0xBE, 0x00, 0x01, 0x8B,
+  0x00, 0x14, 0x04, 0x01, 0x01, 0x0C, 0x05, 0x04, 0x18, 0x0A, 0x09, 0x28, 0x10, 0x10, 0x3C, 0x19,
+  0x18, 0x54, 0x23, 0x21, 0x70, 0x2E, 0x2C, 0xBE, 0x00, 0x01, 0x8B, 0x00, 0x17, 0x01, 0x00, 0x00,
+  0x07, 0x03, 0x03, 0x11, 0x07, 0x07, 0x1F, 0x0C, 0x0D, 0x31, 0x13, 0x15, 0x47, 0x1C, 0x1F, 0x61,
+  0x27, 0x2A, 0x7F, 0x33, 0x37, 0xBB, 0x00, 0x01, 0x8E, 0x00, 0x14, 0x04, 0x01, 0x02, 0x0C, 0x04,
+  0x06, 0x18, 0x09, 0x0C, 0x28, 0x10, 0x13, 0x3C, 0x18, 0x1D, 0x54, 0x21, 0x29, 0x70, 0x2C, 0x37,
+  0xBB, 0x00, 0x01, 0x8E, 0x00, 0x17, 0x01, 0x00, 0x01, 0x07, 0x03, 0x04, 0x11, 0x07, 0x09, 0x1F,
+  0x0C, 0x11, 0x31, 0x13, 0x1B, 0x47, 0x1C, 0x27, 0x61, 0x27, 0x35, 0x7F, 0x33, 0x46, 0xB8, 0x00,
+  0x01, 0x91, 0x00, 0x14, 0x04, 0x01, 0x02, 0x0C, 0x04, 0x07, 0x18, 0x09, 0x0E, 0x28, 0x10, 0x18,
+  0x3C, 0x18, 0x24, 0x54, 0x21, 0x33, 0x70, 0x2C, 0x43, 0xB8, 0x00, 0x01, 0x91, 0x00, 0x17, 0x01,
+  0x00, 0x01, 0x07, 0x03, 0x05, 0x11, 0x07, 0x0B, 0x1F, 0x0C, 0x15, 0x31, 0x13, 0x20, 0x47, 0x1C,
+  0x2F, 0x61, 0x27, 0x40, 0x7F, 0x33, 0x54, 0xB5, 0x00, 0x01, 0x94, 0x00, 0x14, 0x04, 0x01, 0x03,
+  0x0C, 0x04, 0x08, 0x18, 0x09, 0x11, 0x28, 0x10, 0x1C, 0x3C, 0x18, 0x2B, 0x54, 0x21, 0x3C, 0x70,
+  0x2C, 0x50, 0xB5, 0x00, 0x01, 0x94, 0x00, 0x17, 0x01, 0x00, 0x01, 0x07, 0x03, 0x06, 0x11, 0x07,
+  0x0D, 0x1F, 0x0C, 0x18, 0x31, 0x13, 0x26, 0x47, 0x1C, 0x37, 0x61, 0x27, 0x4B, 0x7F, 0x33, 0x62,
+  0xB2, 0x00, 0x01, 0x97, 0x00, 0x14, 0x04, 0x01, 0x03, 0x0C, 0x04, 0x0A, 0x18, 0x09, 0x14, 0x28,
+  0x10, 0x21, 0x3C, 0x18, 0x32, 0x54, 0x21, 0x45, 0x70, 0x2C, 0x5D, 0xB2, 0x00, 0x01, 0x97, 0x00,
+  0x17, 0x01, 0x00, 0x01, 0x07, 0x03, 0x07, 0x11, 0x07, 0x0F, 0x1F, 0x0C, 0x1C, 0x31, 0x13, 0x2C,
+  0x47, 0x1C, 0x3F, 0x61, 0x27, 0x56, 0x7F, 0x33, 0x71, 0xAF, 0x00, 0x01, 0x9A, 0x00, 0x14, 0x04,
+  0x01, 0x04, 0x0C, 0x04, 0x0B, 0x18, 0x09, 0x17, 0x28, 0x10, 0x26, 0x3C, 0x18, 0x38, 0x54, 0x21,
+  0x4F, 0x70, 0x2C, 0x69, 0xAF, 0x00, 0x01, 0x9A, 0x00, 0x17, 0x01, 0x00, 0x01, 0x07, 0x03, 0x07,
+  0x11, 0x07, 0x11, 0x1F, 0x0C, 0x1F, 0x31, 0x13, 0x31, 0x47, 0x1C, 0x47, 0x61, 0x27, 0x61, 0x7F,
+  0x33, 0x7F, 0xAC, 0x00, 0x01, 0x9D, 0x00, 0x14, 0x04, 0x01, 0x04, 0x0B, 0x04, 0x0C, 0x17, 0x09,
+  0x18, 0x26, 0x10, 0x28, 0x38, 0x18, 0x3C, 0x4F, 0x21, 0x54, 0x69, 0x2C, 0x70, 0xAC, 0x00, 0x01,
+  0x9D, 0x00, 0x17, 0x01, 0x00, 0x01, 0x07, 0x03, 0x07, 0x0F, 0x07, 0x11, 0x1C, 0x0C, 0x1F, 0x2C,
+  0x13, 0x31, 0x3F, 0x1C, 0x47, 0x56, 0x27, 0x61, 0x71, 0x33, 0x7F, 0xA9, 0x00, 0x01, 0xA0, 0x00,
+  0x14, 0x03, 0x01, 0x04, 0x0A, 0x04, 0x0C, 0x14, 0x09, 0x18, 0x21, 0x10, 0x28, 0x32, 0x18, 0x3C,
+  0x45, 0x21, 0x54, 0x5D, 0x2C, 0x70, 0xA9, 0x00, 0x01, 0xA0, 0x00, 0x17, 0x01, 0x00, 0x01, 0x06,
+  0x03, 0x07, 0x0D, 0x07, 0x11, 0x18, 0x0C, 0x1F, 0x26, 0x13, 0x31, 0x37, 0x1C, 0x47, 0x4B, 0x27,
+  0x61, 0x62, 0x33, 0x7F, 0xA6, 0x00, 0x01, 0xA3, 0x00, 0x14, 0x03, 0x01, 0x04, 0x08, 0x04, 0x0C,
+  0x11, 0x09, 0x18, 0x1C, 0x10, 0x28, 0x2B, 0x18, 0x3C, 0x3C, 0x21, 0x54, 0x50, 0x2C, 0x70, 0xA6,
+  0x00, 0x01, 0xA3, 0x00, 0x17, 0x01, 0x00, 0x01, 0x05, 0x03, 0x07, 0x0B, 0x07, 0x11, 0x15, 0x0C,
+  0x1F, 0x20, 0x13, 0x31, 0x2F, 0x1C, 0x47, 0x40, 0x27, 0x61, 0x54, 0x33, 0x7F, 0xA3, 0x00, 0x01,
+  0xA6, 0x00, 0x14, 0x02, 0x01, 0x04, 0x07, 0x04, 0x0C, 0x0E, 0x09, 0x18, 0x18, 0x10, 0x28, 0x24,
+  0x18, 0x3C, 0x33, 0x21, 0x54, 0x43, 0x2C, 0x70, 0xA3, 0x00, 0x01, 0xA6, 0x00, 0x17, 0x01, 0x00,
+  0x01, 0x04, 0x03, 0x07, 0x09, 0x07, 0x11, 0x11, 0x0C, 0x1F, 0x1B, 0x13, 0x31, 0x27, 0x1C, 0x47,
+  0x35, 0x27, 0x61, 0x46, 0x33, 0x7F, 0xA0, 0x00, 0x01, 0xA9, 0x00, 0x14, 0x02, 0x01, 0x04, 0x06,
+  0x04, 0x0C, 0x0C, 0x09, 0x18, 0x13, 0x10, 0x28, 0x1D, 0x18, 0x3C, 0x29, 0x21, 0x54, 0x37, 0x2C,
+  0x70, 0xA0, 0x00, 0x01, 0xAB, 0x00, 0x02, 0x01, 0x03, 0x03, 0x82, 0x07, 0x0F, 0x11, 0x0D, 0x0C,
+  0x1F, 0x15, 0x13, 0x31, 0x1F, 0x1C, 0x47, 0x2A, 0x27, 0x61, 0x37, 0x33, 0x7F, 0x9D, 0x00, 0x01,
+  0xAC, 0x00, 0x14, 0x01, 0x01, 0x04, 0x04, 0x05, 0x0C, 0x09, 0x0A, 0x18, 0x10, 0x10, 0x28, 0x18,
+  0x19, 0x3C, 0x21, 0x23, 0x54, 0x2C, 0x2E, 0x70, 0x9D, 0x00, 0x01, 0xAE, 0x00, 0x15, 0x01, 0x03,
+  0x03, 0x07, 0x07, 0x08, 0x11, 0x0C, 0x0F, 0x1F, 0x13, 0x17, 0x31, 0x1C, 0x22, 0x47, 0x27, 0x2E,
+  0x61, 0x33, 0x3C, 0x7F, 0x9A, 0x00, 0x01, 0xAF, 0x00, 0x14, 0x01, 0x02, 0x04, 0x04, 0x06, 0x0C,
+  0x09, 0x0C, 0x18, 0x10, 0x15, 0x28, 0x18, 0x20, 0x3C, 0x21, 0x2C, 0x54, 0x2C, 0x3B, 0x70, 0x9A,
+  0x00, 0x01, 0xB0, 0x00, 0x16, 0x01, 0x01, 0x03, 0x04, 0x07, 0x07, 0x0A, 0x11, 0x0C, 0x12, 0x1F,
+  0x13, 0x1D, 0x31, 0x1C, 0x2A, 0x47, 0x27, 0x39, 0x61, 0x33, 0x4A, 0x7F, 0x97, 0x00, 0x01, 0xB2,
+  0x00, 0x14, 0x01, 0x02, 0x04, 0x04, 0x08, 0x0C, 0x09, 0x0F, 0x18, 0x10, 0x19, 0x28, 0x18, 0x26,
+  0x3C, 0x21, 0x36, 0x54, 0x2C, 0x48, 0x70, 0x97, 0x00, 0x01, 0xB3, 0x00, 0x16, 0x01, 0x01, 0x03,
+  0x05, 0x07, 0x07, 0x0C, 0x11, 0x0C, 0x16, 0x1F, 0x13, 0x22, 0x31, 0x1C, 0x32, 0x47, 0x27, 0x44,
+  0x61, 0x33, 0x59, 0x7F, 0x94, 0x00, 0x01, 0xB5, 0x00, 0x14, 0x01, 0x03, 0x04, 0x04, 0x09, 0x0C,
+  0x09, 0x12, 0x18, 0x10, 0x1E, 0x28, 0x18, 0x2D, 0x3C, 0x21, 0x3F, 0x54, 0x2C, 0x54, 0x70, 0x94,
+  0x00, 0x01, 0xB6, 0x00, 0x16, 0x01, 0x01, 0x03, 0x06, 0x07, 0x07, 0x0E, 0x11, 0x0C, 0x19, 0x1F,
+  0x13, 0x28, 0x31, 0x1C, 0x3A, 0x47, 0x27, 0x4F, 0x61, 0x33, 0x67, 0x7F, 0x91, 0x00, 0x01, 0xB8,
+  0x00, 0x14, 0x01, 0x03, 0x04, 0x04, 0x0A, 0x0C, 0x09, 0x15, 0x18, 0x10, 0x23, 0x28, 0x18, 0x34,
+  0x3C, 0x21, 0x49, 0x54, 0x2C, 0x61, 0x70, 0x91, 0x00, 0x01, 0xB9, 0x00, 0x02, 0x01, 0x01, 0x03,
+  0x82, 0x07, 0x10, 0x10, 0x11, 0x0C, 0x1D, 0x1F, 0x13, 0x2E, 0x31, 0x1C, 0x42, 0x47, 0x27, 0x5A,
+  0x61, 0x33, 0x75, 0x7F, 0x8E, 0x00, 0x01, 0xBB, 0x00, 0x00, 0x01, 0x82, 0x04, 0x10, 0x0C, 0x0C,
+  0x09, 0x17, 0x18, 0x10, 0x27, 0x28, 0x18, 0x3B, 0x3C, 0x21, 0x52, 0x54, 0x2C, 0x6D, 0x70, 0x8E,
+  0x00, 0x01, 0xBC, 0x00, 0x02, 0x01, 0x01, 0x03, 0x82, 0x07, 0x10, 0x11, 0x11, 0x0C, 0x1F, 0x1E,
+  0x13, 0x31, 0x2F, 0x1C, 0x47, 0x45, 0x27, 0x61, 0x5D, 0x33, 0x7F, 0x7A, 0x8B, 0x00, 0x01, 0xBE,
+  0x00, 0x00, 0x01, 0x82, 0x04, 0x10, 0x0C, 0x0B, 0x09, 0x18, 0x16, 0x10, 0x28, 0x24, 0x18, 0x3C,
+  0x36, 0x21, 0x54, 0x4C, 0x2C, 0x70, 0x65, 0x8B, 0x00, 0x01, 0xBF, 0x00, 0x16, 0x01, 0x01, 0x03,
+  0x07, 0x06, 0x07, 0x11, 0x0F, 0x0C, 0x1F, 0x1B, 0x13, 0x31, 0x2A, 0x1C, 0x47, 0x3C, 0x27, 0x61,
+  0x52, 0x33, 0x7F, 0x6C, 0x88, 0x00, 0x01, 0xC1, 0x00, 0x14, 0x01, 0x04, 0x03, 0x04, 0x0C, 0x09,
+  0x09, 0x18, 0x13, 0x10, 0x28, 0x20, 0x18, 0x3C, 0x2F, 0x21, 0x54, 0x42, 0x2C, 0x70, 0x58, 0x88,
+  0x00, 0x01, 0xC2, 0x00, 0x16, 0x01, 0x01, 0x03, 0x07, 0x05, 0x07, 0x11, 0x0D, 0x0C, 0x1F, 0x17,
+  0x13, 0x31, 0x24, 0x1C, 0x47, 0x34, 0x27, 0x61, 0x47, 0x33, 0x7F, 0x5E, 0x85, 0x00, 0x01, 0xC4,
+  0x00, 0x14, 0x01, 0x04, 0x03, 0x04, 0x0C, 0x08, 0x09, 0x18, 0x10, 0x10, 0x28, 0x1B, 0x18, 0x3C,
+  0x29, 0x21, 0x54, 0x39, 0x2C, 0x70, 0x4C, 0x85, 0x00, 0x01, 0xC5, 0x00, 0x16, 0x01, 0x01, 0x03,
+  0x07, 0x04, 0x07, 0x11, 0x0B, 0x0C, 0x1F, 0x13, 0x13, 0x31, 0x1F, 0x1C, 0x47, 0x2C, 0x27, 0x61,
+  0x3D, 0x33, 0x7F, 0x4F, 0x82, 0x00, 0x01, 0xC7, 0x00, 0x14, 0x01, 0x04, 0x02, 0x04, 0x0C, 0x07,
+  0x09, 0x18, 0x0D, 0x10, 0x28, 0x16, 0x18, 0x3C, 0x22, 0x21, 0x54, 0x2F, 0x2C, 0x70, 0x3F, 0x82,
+  0x00, 0x01, 0xC8, 0x00, 0x16, 0x01, 0x01, 0x03, 0x07, 0x04, 0x07, 0x11, 0x09, 0x0C, 0x1F, 0x10,
+  0x13, 0x31, 0x19, 0x1C, 0x47, 0x24, 0x27, 0x61, 0x32, 0x33, 0x7F, 0x41, 0x01, 0xCA, 0x00, 0x14,
+  0x01, 0x04, 0x02, 0x04, 0x0C, 0x05, 0x09, 0x18, 0x0B, 0x10, 0x28, 0x12, 0x18, 0x3C, 0x1B, 0x21,
+  0x54, 0x26, 0x2C, 0x70, 0x33,
+};
+
+#endif
+
+// End of file.
@@ -0,0 +1,167 @@
+#include "audioAnalysis.h"
+
+uint8_t audioLevel;
+uint8_t audioBands[AUDIO_BANDS];
+uint8_t audioBeatPulse;
+boolean audioBeat;
+
+// Sine of 2*pi*i/32 in Q15. Three quarters of a cycle, so cos(x) is read as sin(x + 8).
+PROGMEM prog_int16_t __fftSine[] = {
+       0,   6393,  12539,  18204,  23170,  27245,  30273,  32137,
+   32767,  32137,  30273,  27245,  23170,  18204,  12539,   6393,
+       0,  -6393, -12539, -18204, -23170, -27245, -30273, -32137
+};
+
+#define FFT_SINE(i) ((int16_t)pgm_read_word(&__fftSine[i]))
+
+// Hann window in Q15. Without it a tone between two bins spreads across the whole spectrum, and a bass line in
+// the low mid band leaks enough into the bass band to fire beats of its own.
+PROGMEM prog_uint16_t __fftWindow[AUDIO_BLOCK_SIZE] = {
+       0,    315,   1247,   2761,   4799,   7281,  10114,  13187,
+   16383,  19580,  22653,  25486,  27968,  30006,  31520,  32452,
+   32767,  32452,  31520,  30006,  27968,  25486,  22653,  19580,
+   16384,  13187,  10114,   7281,   4799,   2761,   1247,    315
+};
+
+// Last bin (exclusive) of each band. Bin 0 is DC and is skipped.
+PROGMEM prog_uchar __bandEnd[AUDIO_BANDS] = { 3, 5, 9, 16 };
+
+static int16_t  __fftRe[AUDIO_BLOCK_SIZE];
+static int16_t  __fftIm[AUDIO_BLOCK_SIZE];
+static uint16_t __bandPeak[AUDIO_BANDS];  // Auto gain reference per band
+static uint16_t __levelPeak;
+static uint16_t __bassAverage;            // Slow running average of the bass energy, 12.4 fixed point
+static uint8_t  __beatHoldoff;            // Blocks left before another beat may fire
+
+// Peaks decay by 1/64 per block (about 0.85 s time constant) and never drop below the noise floor.
+#define AUDIO_PEAK_FLOOR   64
+// A beat is bass energy 1.5 times above the running average.
+#define AUDIO_BEAT_RATIO_NUM 3
+#define AUDIO_BEAT_RATIO_DEN 2
+// 18 blocks of 32 samples at 2404 Hz is about 240 ms, a little faster than 240 bpm.
+#define AUDIO_BEAT_HOLDOFF 18
+
+
+void resetAudioAnalysis(void) {
+  audioLevel = audioBeatPulse = 0;
+  audioBeat = false;
+  for(uint8_t b = 0; b < AUDIO_BANDS; b++) {
+    audioBands[b] = 0;
+    __bandPeak[b] = AUDIO_PEAK_FLOOR;
+  }
+  __levelPeak   = AUDIO_PEAK_FLOOR;
+  __bassAverage = 0;
+  __beatHoldoff = 0;
+} // resetAudioAnalysis()
+
+
+// In-place radix-2 decimation in time FFT over 32 points.
+// Every stage halves its outputs, so the result is the true spectrum divided by 32.
+void fft32(int16_t *re, int16_t *im) {
+
+  // Reorder the input into bit reversed index order.
+  for(uint8_t i = 1; i < 31; i++) {
+    uint8_t r = ((i & 1) << 4) | ((i & 2) << 2) | (i & 4) | ((i & 8) >> 2) | ((i & 16) >> 4);
+    if(r > i) {
+      int16_t t;
+      t = re[i]; re[i] = re[r]; re[r] = t;
+      t = im[i]; im[i] = im[r]; im[r] = t;
+    }
+  }
+
+  for(uint8_t half = 1, shift = 4; half < 32; half <<= 1, shift--) {
+    for(uint8_t m = 0; m < half; m++) {
+      uint8_t k  = m << shift;        // Twiddle index, 0-15
+      int16_t wr =  FFT_SINE(k + 8);  // cos
+      int16_t wi = -FFT_SINE(k);      // -sin
+
+      for(uint8_t i = m; i < 32; i += half << 1) {
+        uint8_t j = i + half;
+        int16_t tr = ((int32_t)wr * re[j] - (int32_t)wi * im[j]) >> 16; // >> 15 for Q15, >> 1 for the stage scale
+        int16_t ti = ((int32_t)wr * im[j] + (int32_t)wi * re[j]) >> 16;
+        int16_t qr = re[i] >> 1;
+        int16_t qi = im[i] >> 1;
+        re[j] = qr - tr;
+        im[j] = qi - ti;
+        re[i] = qr + tr;
+        im[i] = qi + ti;
+      }
+    }
+  }
+} // fft32()
+
+
+// |z| within about 4% using max + min/2 - max/16 - min/16; no square root.
+static uint16_t magnitude(int16_t re, int16_t im) {
+  uint16_t a = re < 0 ? -re : re;
+  uint16_t b = im < 0 ? -im : im;
+  if(a < b) { uint16_t t = a; a = b; b = t; }
+  return a - (a >> 4) + (b >> 1) - (b >> 4);
+} // magnitude()
+
+
+// Scale energy against a peak that jumps up instantly and decays slowly.
+static uint8_t autoGain(uint16_t energy, uint16_t *peak) {
+  if(energy > *peak)
+    *peak = energy;
+  else if(*peak > AUDIO_PEAK_FLOOR)
+    *peak -= (*peak >> 6) + 1;
+
+  uint32_t scaled = ((uint32_t)energy << 8) / (*peak + 1);
+  return scaled > 255 ? 255 : scaled;
+} // autoGain()
+
+
+void processAudioBlock(const int16_t *samples, boolean gap) {
+
+  // Remove the DC bias of the microphone, scale up to use the FFT's headroom and window.
+  // Samples are at most 12 bits (four summed 10-bit conversions), so << 3 stays within +-32767. The window
+  // halves the level of a steady tone, which the extra bit gives back.
+  int32_t sum = 0;
+  for(uint8_t i = 0; i < AUDIO_BLOCK_SIZE; i++)
+    sum += samples[i];
+  int16_t mean = sum / AUDIO_BLOCK_SIZE;
+
+  for(uint8_t i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+    __fftRe[i] = ((int32_t)((samples[i] - mean) << 3) * pgm_read_word(&__fftWindow[i])) >> 15;
+    __fftIm[i] = 0;
+  }
+
+  fft32(__fftRe, __fftIm);
+
+  uint16_t total = 0;
+  uint8_t  bin   = 1;
+  for(uint8_t b = 0; b < AUDIO_BANDS; b++) {
+    uint16_t energy = 0;
+    uint8_t  end    = pgm_read_byte(&__bandEnd[b]);
+    for(; bin < end; bin++)
+      energy += magnitude(__fftRe[bin], __fftIm[bin]);
+
+    audioBands[b] = autoGain(energy, &__bandPeak[b]);
+    total += energy >> 2;
+
+    // Onset detection on the bass band.
+    if(b == 0) {
+      uint16_t bass = energy > 4095 ? 4095 : energy;
+      uint16_t average = __bassAverage >> 4;
+      if(__beatHoldoff)
+        __beatHoldoff--;
+      else if(!gap && bass > AUDIO_PEAK_FLOOR &&
+              (uint32_t)bass * AUDIO_BEAT_RATIO_DEN > (uint32_t)average * AUDIO_BEAT_RATIO_NUM) {
+        audioBeat      = true;
+        audioBeatPulse = 255;
+        __beatHoldoff  = AUDIO_BEAT_HOLDOFF;
+      }
+      // Running average over about 16 blocks (0.2 s). The step at a gap stays out of it too.
+      if(!gap)
+        __bassAverage += bass - average;
+    }
+  }
+
+  audioLevel = autoGain(total, &__levelPeak);
+
+  // 255 to 0 in about 15 blocks.
+  audioBeatPulse = audioBeatPulse > 17 ? audioBeatPulse - 17 : 0;
+} // processAudioBlock()
+
+// End of file.
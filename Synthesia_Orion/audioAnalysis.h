@@ -0,0 +1,35 @@
+#ifndef __SYNTHESIA_AUDIO_ANALYSIS_H
+#define __SYNTHESIA_AUDIO_ANALYSIS_H
+
+#include <Arduino.h>
+
+// Spectrum and beat analysis of the microphone signal.
+// This half of the audio path has no hardware dependencies. It takes blocks of samples from
+// audioSampler, or from a recording on the host, and updates the levels the audio modes draw from.
+//
+// Each block of AUDIO_BLOCK_SIZE samples is Hann windowed and goes through a 32-point integer FFT (Q15 twiddles,
+// halved at every stage so nothing overflows). At the 2404 Hz sample rate each bin is 75 Hz wide.
+// The bins are then summed into AUDIO_BANDS bands. The bass band feeds an onset detector that
+// compares each block against a slow running average. Levels are auto gained against a decaying
+// peak, so quiet and loud rooms both use the full 0-255 range. A block with a gap in it has a step where the
+// samples join, which would look like an onset, so it is never taken for a beat.
+//
+// SRAM use is the 2 x 32 word FFT work area plus a few bytes of state, about 150 bytes.
+
+#define AUDIO_BLOCK_SIZE 32
+#define AUDIO_BANDS       4  // Bass 75-150 Hz, low mid 225-300 Hz, mid 375-600 Hz, high 675-1125 Hz
+
+extern uint8_t audioLevel;              // Overall loudness, 0-255
+extern uint8_t audioBands[AUDIO_BANDS]; // Per band loudness, 0-255
+extern uint8_t audioBeatPulse;          // 255 on a beat, then decays towards 0 over about 200 ms
+extern boolean audioBeat;               // Set on every beat. The reader clears it.
+
+void resetAudioAnalysis(void);
+void processAudioBlock(const int16_t *samples, boolean gap); // AUDIO_BLOCK_SIZE raw samples, any DC offset.
+                                                               // gap if samples were lost before or inside it.
+
+void fft32(int16_t *re, int16_t *im);
+
+#endif
+
+// End of file.
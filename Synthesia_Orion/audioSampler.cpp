@@ -0,0 +1,241 @@
+#include "audioSampler.h"
+#include "audioAnalysis.h"
+#include "pins.h"
+
+static volatile uint16_t __audioRing[AUDIO_RING_SIZE];
+static volatile uint8_t  __audioHead;      // Written only by the ISR
+static uint8_t           __audioTail;      // Written only by the main loop
+static volatile uint16_t __audioOverruns;  // Samples dropped on a full ring, since the last readAudioOverruns()
+static uint16_t          __audioSeen;      // __audioOverruns as of the last block analysed
+static uint16_t          __audioSum;       // ISR only
+static uint8_t           __audioDecimate;  // ISR only
+static boolean           __audioRunning = false;
+
+// Auxiliary conversions. AUX_REQUESTED, AUX_SWITCHING and AUX_RETURNING are only used while sampling runs.
+enum {
+  AUX_IDLE,
+  AUX_DONE,      // Result waiting in __auxSum
+  AUX_REQUESTED, // Switch to the aux channel on the next conversion
+  AUX_SWITCHING, // The conversion already running is still the microphone
+  AUX_SETTLING,  // First aux result. Thrown away while the sample and hold settles on the new channel.
+  AUX_SAMPLING,
+  AUX_RETURNING  // Switched back, but the conversion already running is still aux
+};
+static volatile uint8_t  __auxState = AUX_IDLE;
+static uint8_t           __auxChannel;
+static uint8_t           __auxWanted;
+static volatile uint16_t __auxSum;
+static volatile uint8_t  __auxCount;
+static uint16_t          __lastMicSample; // ISR only
+
+// ADMUX and ADCSRB for a channel, with the internal 2.56 V reference to match analogReference(INTERNAL) in setup().
+#define ADMUX_FOR(channel)  ((1 << REFS1) | (1 << REFS0) | ((channel) & 0x07))
+#define ADCSRB_FOR(channel) (((channel) & 0x08) ? (1 << MUX5) : 0) // Auto trigger source 0 is free running.
+
+
+void startAudioSampling(void) {
+  if(__audioRunning)
+    return;
+
+  cli();
+  // Single aux conversions still under way are dropped with the ADC taken over. The next start begins afresh.
+  if(__auxState > AUX_DONE)
+    __auxState = AUX_IDLE;
+  __audioHead = __audioTail = 0;
+  __audioSeen = __audioOverruns;
+  __audioSum = 0;
+  __audioDecimate = 0;
+
+  ADMUX  = ADMUX_FOR(ADC_CHANNEL_MIC);
+  ADCSRB = ADCSRB_FOR(ADC_CHANNEL_MIC);
+  // Enable, start, auto trigger, interrupt, /128 prescaler.
+  ADCSRA = (1 << ADEN) | (1 << ADSC) | (1 << ADATE) | (1 << ADIE) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+  // Set before interrupts are back on, so the first conversion goes to the ring, not to the aux sum.
+  __audioRunning = true;
+  sei();
+
+  resetAudioAnalysis();
+} // startAudioSampling()
+
+
+void stopAudioSampling(void) {
+  if(!__audioRunning)
+    return;
+
+  // Leave the ADC enabled but idle, the way analogRead() expects to find it.
+  ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+  __audioRunning = false;
+
+  // Interleaved aux conversions still under way are dropped. The next startAuxConversions() starts afresh.
+  if(__auxState > AUX_DONE)
+    __auxState = AUX_IDLE;
+} // stopAudioSampling()
+
+
+boolean suspendAudioSampling(void) {
+  boolean wasRunning = __audioRunning;
+  stopAudioSampling();
+  return wasRunning;
+} // suspendAudioSampling()
+
+
+void resumeAudioSampling(boolean wasRunning) {
+  if(wasRunning)
+    startAudioSampling();
+} // resumeAudioSampling()
+
+
+ISR(ADC_vect) {
+  uint16_t sample = ADC;
+
+  // Single aux conversions, taken while the microphone is not in use. Each result starts the next conversion.
+  if(!__audioRunning)
+  {
+    if(__auxState == AUX_SAMPLING)
+    {
+      __auxSum += sample;
+      if(++__auxCount >= __auxWanted)
+      {
+        // Leave the ADC enabled but idle, the way analogRead() expects to find it.
+        ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+        __auxState = AUX_DONE;
+        return;
+      }
+    } else if(__auxState == AUX_SETTLING) {
+      __auxState = AUX_SAMPLING;
+    } else {
+      return;
+    }
+    ADCSRA |= (1 << ADSC);
+    return;
+  }
+
+  // Interleaved aux conversions. The ADC is free running, so a channel change only reaches the results two
+  // conversions later. Microphone samples lost in the meantime repeat the last good one.
+  if(__auxState > AUX_DONE)
+  {
+    switch(__auxState)
+    {
+      case AUX_REQUESTED:
+        ADMUX  = ADMUX_FOR(__auxChannel);
+        ADCSRB = ADCSRB_FOR(__auxChannel);
+        __auxState = AUX_SWITCHING;
+        __lastMicSample = sample;
+        break;
+      case AUX_SWITCHING:
+        __auxState = AUX_SETTLING;
+        __lastMicSample = sample;
+        break;
+      case AUX_SETTLING:
+        __auxState = AUX_SAMPLING;
+        sample = __lastMicSample;
+        break;
+      case AUX_SAMPLING:
+        __auxSum += sample;
+        if(++__auxCount >= __auxWanted)
+        {
+          ADMUX  = ADMUX_FOR(ADC_CHANNEL_MIC);
+          ADCSRB = ADCSRB_FOR(ADC_CHANNEL_MIC);
+          __auxState = AUX_RETURNING;
+        }
+        sample = __lastMicSample;
+        break;
+      default: // AUX_RETURNING
+        __auxState = AUX_DONE;
+        sample = __lastMicSample;
+        break;
+    }
+  }
+
+  // Kept to a handful of instructions. It runs nearly 10,000 times a second while an audio mode is active.
+  __audioSum += sample;
+  if(++__audioDecimate < AUDIO_DECIMATION)
+    return;
+
+  // A full ring means the analysis has fallen behind. Drop the new sample rather than overwrite a block that may
+  // be being read, and count it.
+  uint8_t head = __audioHead;
+  uint8_t next = (head + 1) & (AUDIO_RING_SIZE - 1);
+  if(next != __audioTail)
+  {
+    __audioRing[head] = __audioSum;
+    __audioHead = next;
+  } else if(__audioOverruns != 0xFFFF) {
+    __audioOverruns++;
+  }
+  __audioSum = 0;
+  __audioDecimate = 0;
+} // ISR()
+
+
+void startAuxConversions(uint8_t channel, uint8_t count) {
+  __auxSum = 0;
+  __auxCount = 0;
+  __auxWanted = count;
+  __auxChannel = channel;
+
+  if(__audioRunning)
+  {
+    // The ISR takes it from here.
+    __auxState = AUX_REQUESTED;
+    return;
+  }
+
+  // The microphone is off, so the ISR chains single conversions: one thrown away while the sample and hold settles
+  // on the new channel, then count of them, about 104 us each. Nothing waits and no clock stops, so the timers
+  // and the UART carry on.
+  ADMUX  = ADMUX_FOR(channel);
+  ADCSRB = ADCSRB_FOR(channel);
+  __auxState = AUX_SETTLING;
+  ADCSRA = (1 << ADEN) | (1 << ADSC) | (1 << ADIE) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+} // startAuxConversions()
+
+
+boolean auxConversionsReady(uint16_t *sum) {
+  if(__auxState != AUX_DONE)
+    return false;
+
+  uint8_t oldSREG = SREG;
+  cli();
+  *sum = __auxSum;
+  __auxState = AUX_IDLE;
+  SREG = oldSREG;
+  return true;
+} // auxConversionsReady()
+
+
+void updateAudio(void) {
+  int16_t block[AUDIO_BLOCK_SIZE];
+
+  if(!__audioRunning)
+    return;
+
+  // The ring holds at most two blocks, so this is bounded at two FFTs per call.
+  while((uint8_t)((__audioHead - __audioTail) & (AUDIO_RING_SIZE - 1)) >= AUDIO_BLOCK_SIZE) {
+    for(uint8_t i = 0; i < AUDIO_BLOCK_SIZE; i++) {
+      block[i] = __audioRing[__audioTail];
+      __audioTail = (__audioTail + 1) & (AUDIO_RING_SIZE - 1);
+    }
+
+    // Samples dropped since the last block leave a gap somewhere in this one.
+    uint8_t oldSREG = SREG;
+    cli();
+    uint16_t overruns = __audioOverruns;
+    SREG = oldSREG;
+    processAudioBlock(block, overruns != __audioSeen);
+    __audioSeen = overruns;
+  }
+} // updateAudio()
+
+
+uint16_t readAudioOverruns(void) {
+  uint8_t oldSREG = SREG;
+  cli();
+  uint16_t overruns = __audioOverruns;
+  __audioOverruns = 0;
+  __audioSeen = 0;
+  SREG = oldSREG;
+  return overruns;
+} // readAudioOverruns()
+
+// End of file.
@@ -0,0 +1,37 @@
+#ifndef __SYNTHESIA_AUDIO_SAMPLER_H
+#define __SYNTHESIA_AUDIO_SAMPLER_H
+
+#include <Arduino.h>
+
+// Microphone sampling for the audio reactive modes.
+//
+// The ADC free runs on PIN_MIC_SENSE with a /128 prescaler: 16 MHz / 128 / 13 cycles = 9615 conversions per second.
+// The conversion complete interrupt sums groups of AUDIO_DECIMATION conversions, which is a cheap low pass filter.
+// It pushes each sum into a ring buffer, giving a fixed sample rate of 2404 Hz with 12-bit samples.
+// The main loop drains the ring one AUDIO_BLOCK_SIZE block at a time into processAudioBlock().
+// If it falls so far behind that the ring fills, new samples are dropped and counted as overruns. The next block
+// is marked as having a gap for the beat detector, and the energy profile reports the count.
+//
+// The sampler owns the ADC while it runs. Sampling only runs while an audio mode is selected.
+// Other channels are read with startAuxConversions(). While sampling runs they are slipped in between the
+// microphone conversions, costing a few repeated audio samples. Otherwise the conversion interrupt chains single
+// conversions, about 2 ms for 16. Either way auxConversionsReady() hands back the sum once they are in.
+// Nothing else may use analogRead() or the ADC directly, with one exception: seedRandom() (noise.h) reads the
+// floating sense pins with analogRead() in setupOrion(), before the first mode can start sampling and before the
+// tasks that start aux conversions run. It wants the low bit of each single reading, which a sum would blur.
+
+#define AUDIO_DECIMATION 4
+#define AUDIO_RING_SIZE 64 // Two analysis blocks. Must be a power of two.
+
+void startAudioSampling(void);
+void stopAudioSampling(void);
+boolean suspendAudioSampling(void);          // Returns true if sampling was running.
+void resumeAudioSampling(boolean wasRunning);
+void updateAudio(void);                       // Analyse every complete block in the ring.
+uint16_t readAudioOverruns(void);             // Samples dropped since the last read
+void startAuxConversions(uint8_t channel, uint8_t count); // Raw 32U4 ADC channel, up to 64 conversions
+boolean auxConversionsReady(uint16_t *sum);   // True, once, when all count conversions are in
+
+#endif
+
+// End of file.
@@ -1,112 +1,205 @@
 #include "batteryStatus.h"
 #include "pins.h"
+#include "audioSampler.h"
+#include "powerLimiter.h"
+#include "chargeControl.h"
 
-boolean __refreshBatteryStatus; // Interrupt semaphore for updating the battery status.
-
-// initialize Timer1 for use in controlling battery status update
-void setupBatteryStatusInterrupt(void) {
-  // First disable global interrupts during setup.
-  cli();
-  
-  // Clear the TCCR1A and TCCR1B registers.
-  TCCR1A = TCCR1B = 0;
- 
-  // Set compare match register to desired timer count:
-  OCR1A = 3624;
-  // Turn on CTC mode:
-  TCCR1B |= (1 << WGM12);
-  // Set CS10 and CS12 bits for 1024 prescaler:
-  TCCR1B |= (1 << CS10);
-  TCCR1B |= (1 << CS12);
-  // Enable timer compare interrupt:
-  TIMSK1 |= (1 << OCIE1A);
-  // Now that we are finished, renable global interrupts
-  sei();
-} // setupBatteryStatusInterrupt()
-
-
-ISR(TIMER1_COMPA_vect) {
-  // Set a semaphore so the main loop can update the battery status.
-  // This keeps the interrupt small and fast.
-  __refreshBatteryStatus = true;
-} // ISR()
+// LiPo open circuit voltage in mV at every 10% of charge, from empty to full. Flat in the middle, steep at both ends.
+PROGMEM prog_uint16_t __dischargeCurve[11] = { 3300, 3680, 3740, 3770, 3790, 3820, 3870, 3920, 3980, 4060, 4200 };
 
+// Status light colours, in order of charge.
+enum {
+  BATTERY_LIGHT_RED,
+  BATTERY_LIGHT_BLUE,
+  BATTERY_LIGHT_GREEN
+};
+#define BATTERY_BLUE_PERCENT 30
+#define BATTERY_HYSTERESIS    3 // Percent of charge a colour holds on past its threshold
 
-void updateBatteryStatus(boolean isUnitPowered) {
+static int32_t  __batteryFiltered;   // mV << BATTERY_FILTER_SHIFT, 0 until the first reading
+static uint16_t __currentFiltered;   // mA << BATTERY_FILTER_SHIFT
+static uint16_t __batteryMillivolts;
+static uint8_t  __batteryPercent;
+static uint8_t  __batteryLight = BATTERY_LIGHT_GREEN;
+static boolean  __onUsb;
 
-//    digitalWrite(PIN_LED_GREEN, HIGH);
-//  digitalWrite(PIN_LED_RED  , HIGH);
-//  digitalWrite(PIN_LED_BLUE , HIGH);
 
-  if(! __refreshBatteryStatus)
-    return;
-    
-  //Now that the battery status has been updated reset the interrupt semaphone.
-  __refreshBatteryStatus = false;
+static uint8_t chargeFromVoltage(uint16_t mv) {
+  if(mv <= pgm_read_word(&__dischargeCurve[0]))
+    return 0;
+
+  for(uint8_t i = 1; i < 11; i++)
+  {
+    uint16_t upper = pgm_read_word(&__dischargeCurve[i]);
+    if(mv < upper)
+    {
+      uint16_t lower = pgm_read_word(&__dischargeCurve[i - 1]);
+      return (i - 1) * 10 + (uint16_t)(mv - lower) * 10 / (upper - lower);
+    }
+  }
+  return 100;
+} // chargeFromVoltage()
+
+
+// Fold one oversampled reading into the filters.
+static void updateFuelGauge(uint16_t sum, boolean isUnitPowered) {
+  // 2.56 V reference over a 1:2 divider is 5 mV a count.
+  int32_t measured = (uint32_t)sum * 5 / BATTERY_OVERSAMPLE;
+
+  uint16_t current = BATTERY_SYSTEM_MA;
+  if(isUnitPowered)
+    current += stripCurrent();
+
+  if(__batteryFiltered == 0)
+  {
+    __batteryFiltered = measured << BATTERY_FILTER_SHIFT;
+    __currentFiltered = current << BATTERY_FILTER_SHIFT;
+  } else {
+    __batteryFiltered += measured - (__batteryFiltered >> BATTERY_FILTER_SHIFT);
+    __currentFiltered += current - (__currentFiltered >> BATTERY_FILTER_SHIFT);
+  }
+
+  // Add back the drop across the cell's internal resistance. On USB the charger holds the cell up instead.
+  uint16_t mv = __batteryFiltered >> BATTERY_FILTER_SHIFT;
+  if(!__onUsb)
+    mv += ((uint32_t)(__currentFiltered >> BATTERY_FILTER_SHIFT) * BATTERY_RESISTANCE_MOHM) / 1000;
+
+  __batteryMillivolts = mv;
+  __batteryPercent = chargeFromVoltage(mv);
+} // updateFuelGauge()
+
+
+// Dim the strip through the limiter's scale over the last BATTERY_LOW_PERCENT of charge.
+static void updateLowBatteryScale(void) {
+  uint16_t scale = 256;
+  if(!__onUsb && __batteryPercent < BATTERY_LOW_PERCENT)
+  {
+    scale = ((uint16_t)__batteryPercent << 8) / BATTERY_LOW_PERCENT;
+    if(scale < BATTERY_MIN_SCALE)
+      scale = BATTERY_MIN_SCALE;
+  }
+  setScaleLimit(scale);
+} // updateLowBatteryScale()
+
+
+// Each colour is kept until the charge is BATTERY_HYSTERESIS past the threshold that would change it.
+static void updateBatteryLight(void) {
+  uint8_t percent = __batteryPercent;
+
+  switch(__batteryLight)
+  {
+    case BATTERY_LIGHT_RED:
+      if(percent >= BATTERY_LOW_PERCENT + BATTERY_HYSTERESIS)
+        __batteryLight = BATTERY_LIGHT_BLUE;
+      break;
+    case BATTERY_LIGHT_BLUE:
+      if(percent < BATTERY_LOW_PERCENT)
+        __batteryLight = BATTERY_LIGHT_RED;
+      else if(percent >= BATTERY_BLUE_PERCENT + BATTERY_HYSTERESIS)
+        __batteryLight = BATTERY_LIGHT_GREEN;
+      break;
+    default:
+      if(percent < BATTERY_BLUE_PERCENT)
+        __batteryLight = BATTERY_LIGHT_BLUE;
+      break;
+  }
+} // updateBatteryLight()
 
-  
-  // @todo DOC
-  float batteryVoltage = analogRead(PIN_V_SENSE)*0.005;
+
+void updateBatteryStatus(boolean isUnitPowered) {
+  // Called by the battery task every BATTERY_UPDATE_PERIOD ms.
+  // The conversions started last time are in by now: they take 2 ms with the sampler idle.
+  // Either way the gauge is at most one update behind.
+  uint16_t sum;
+  __onUsb = usbPowered();
+  if(auxConversionsReady(&sum))
+  {
+    updateFuelGauge(sum, isUnitPowered);
+    updateBatteryLight();
+    updateLowBatteryScale();
+    updateCharger(isUnitPowered);
+  }
+  startAuxConversions(ADC_CHANNEL_V_SENSE, BATTERY_OVERSAMPLE);
 
   // Turn all the LEDs off, this is the default state.
-  digitalWrite(PIN_LED_GREEN, HIGH);
-  digitalWrite(PIN_LED_RED  , HIGH);
-  digitalWrite(PIN_LED_BLUE , HIGH);
-  
-  // USB power detection
-  // When charging LED is purple. When fully charged LED is white.
-  if(!(UDINT & B00000001))
+  Pin<PIN_LED_GREEN>::high();
+  Pin<PIN_LED_RED>::high();
+  Pin<PIN_LED_BLUE>::high();
+
+  if(__batteryFiltered == 0)
+    return;
+
+  // On USB the light shows the charge phase instead: purple while charging normally, yellow while held back
+  // by load, cyan while topping off, white when full.
+  if(__onUsb)
   {
-    if(batteryVoltage < 4.0)
+    switch(chargePhase())
     {
-      //digitalWrite(PIN_LED_GREEN, LOW);
-      digitalWrite(PIN_LED_RED  , LOW);
-      digitalWrite(PIN_LED_BLUE , LOW); 
-      return;
-    } else {
-        // Flashing white
-      digitalWrite(PIN_LED_GREEN, LOW);
-      digitalWrite(PIN_LED_RED  , LOW);
-      digitalWrite(PIN_LED_BLUE , LOW); 
-      return;
+      case CHARGE_LIMITED:
+        Pin<PIN_LED_RED>::low();
+        Pin<PIN_LED_GREEN>::low();
+        break;
+      case CHARGE_TOPPING:
+        Pin<PIN_LED_GREEN>::low();
+        Pin<PIN_LED_BLUE>::low();
+        break;
+      case CHARGE_FULL:
+        Pin<PIN_LED_GREEN>::low();
+        Pin<PIN_LED_RED>::low();
+        Pin<PIN_LED_BLUE>::low();
+        break;
+      default:
+        Pin<PIN_LED_RED>::low();
+        Pin<PIN_LED_BLUE>::low();
+        break;
     }
+    return;
   }
-  
+
   // If the unit is powered off, then don't turn on any leds as this wastes battery power.
   if(!isUnitPowered)
     return;
-    
-  if(batteryVoltage < 3.0) {
-    digitalWrite(PIN_LED_RED, LOW);
-    return;
-  }
-  
-  if(batteryVoltage < 3.5) {
-    digitalWrite(PIN_LED_BLUE, LOW);
-    return;
-  }
 
-  digitalWrite(PIN_LED_GREEN, LOW);
-  
-  
-  // If fully charged or charging turn on all the LEDs (white) 
-//  bit usbConnected = (USBSTA & = 0x01);
-//USBSTA & 1
-//  if(UDINT & B00000001)
-//  {
-//
-//  } else {
-//     digitalWrite(PIN_LED_GREEN, LOW);
-//  digitalWrite(PIN_LED_RED  , LOW);
-//  digitalWrite(PIN_LED_BLUE , LOW); 
-//  }
+  switch(__batteryLight)
+  {
+    case BATTERY_LIGHT_RED:
+      Pin<PIN_LED_RED>::low();
+      break;
+    case BATTERY_LIGHT_BLUE:
+      Pin<PIN_LED_BLUE>::low();
+      break;
+    default:
+      Pin<PIN_LED_GREEN>::low();
+      break;
+  }
 } // updateBatteryStatus()
 
+
+uint16_t batteryMillivolts(void) {
+  return __batteryMillivolts;
+} // batteryMillivolts()
+
+
+uint8_t batteryChargePercent(void) {
+  return __batteryPercent;
+} // batteryChargePercent()
+
+
+uint16_t batteryMinutesRemaining(void) {
+  if(__onUsb)
+    return 0xFFFF;
+
+  uint16_t current = __currentFiltered >> BATTERY_FILTER_SHIFT;
+  if(current == 0)
+    return 0xFFFF;
+  return ((uint32_t)__batteryPercent * BATTERY_CAPACITY_MAH * 60 / 100) / current;
+} // batteryMinutesRemaining()
+
+
 void forceStatusLightOff() {
     // Turn all the LEDs off, this is the default state.
-  digitalWrite(PIN_LED_GREEN, HIGH);
-  digitalWrite(PIN_LED_RED  , HIGH);
-  digitalWrite(PIN_LED_BLUE , HIGH);
+  Pin<PIN_LED_GREEN>::high();
+  Pin<PIN_LED_RED>::high();
+  Pin<PIN_LED_BLUE>::high();
 }
 // End of file.
-
@@ -3,11 +3,40 @@
 
 #include <Arduino.h>
 
-void setupBatteryStatusInterrupt(void);
+// How often the scheduler updates the battery status light, in ms.
+// It used to be Timer1 at 16 MHz / 1024 / 3625, which is the same 232 ms.
+#define BATTERY_UPDATE_PERIOD 232
+
+// Fuel gauge.
+//
+// Every update takes BATTERY_OVERSAMPLE conversions of the battery sense through the audio sampler (interleaved
+// with the microphone, or chained from the conversion interrupt when it is off) and low pass filters them, all in
+// integer mV.
+// Under load the cell sags by its internal resistance times the current, so the strip current estimate is
+// filtered too and the drop added back before the voltage is looked up on a LiPo discharge curve.
+// The charge and the filtered current give the minutes remaining.
+//
+// Below BATTERY_LOW_PERCENT the power limiter's output scale is capped in step with the charge, from full at
+// BATTERY_LOW_PERCENT down to BATTERY_MIN_SCALE, which dims whatever mode is running and stretches the last
+// minutes out. The cap comes off on USB power. The power budget itself is left alone.
+// The status light follows the charge, with a little hysteresis so it does not flicker between colours.
+
+#define BATTERY_OVERSAMPLE         16 // Conversions per update. 2 extra bits.
+#define BATTERY_FILTER_SHIFT        3 // IIR filter weight, 1/8 per update, about 2 s to settle
+#define BATTERY_RESISTANCE_MOHM   150 // Cell plus wiring
+#define BATTERY_SYSTEM_MA          40 // Everything but the strip
+#define BATTERY_LOW_PERCENT        10 // Start dimming below this
+#define BATTERY_MIN_SCALE          64 // ...but never below a quarter
+#ifndef BATTERY_CAPACITY_MAH
+#define BATTERY_CAPACITY_MAH     2200
+#endif
+
 void updateBatteryStatus(boolean isUnitPowered);
 void forceStatusLightOff();
+uint16_t batteryMillivolts(void);        // Filtered and sag compensated, 0 until the first reading
+uint8_t batteryChargePercent(void);
+uint16_t batteryMinutesRemaining(void);  // At the current draw. 0xFFFF on USB power.
 
 #endif
 
 // End of file.
-
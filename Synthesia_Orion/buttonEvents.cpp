@@ -0,0 +1,212 @@
+#include "buttonEvents.h"
+#include "pins.h"
+#include "timeBase.h"
+#include "scheduler.h"
+
+enum {
+  BUTTON_RELEASED,
+  BUTTON_PRESSED,
+  BUTTON_HELD
+};
+
+static volatile uint8_t       __edgeButton[BUTTON_QUEUE_SIZE];
+static volatile unsigned long __edgeTime[BUTTON_QUEUE_SIZE];
+static volatile uint8_t       __edgeHead;  // Written only by the ISRs
+static uint8_t                __edgeTail;  // Written only by the main loop
+static ButtonState            __buttons[BUTTON_COUNT];
+
+static uint16_t      __latencyCount;
+static unsigned long __latencySum;
+static unsigned long __latencyWorst;
+
+
+#define BUTTON_PCINT_MASK (BUTTON_MODE_PCINT_MASK | BUTTON_SPEED_PCINT_MASK)
+static uint8_t __pinbLast = BUTTON_PCINT_MASK; // Port B as the pin change ISR last saw it. Pulled up, so idle high.
+
+
+static inline void pushButtonEdge(uint8_t button, unsigned long time) {
+  uint8_t head = __edgeHead;
+  uint8_t next = (head + 1) & (BUTTON_QUEUE_SIZE - 1);
+  // Full means the main loop is far behind, and these can only be more bounce.
+  if(next == __edgeTail)
+    return;
+
+  __edgeButton[head] = button;
+  __edgeTime[head] = time;
+  __edgeHead = next;
+  wakeTasks();
+} // pushButtonEdge()
+
+
+void queueButtonEdge(uint8_t button) {
+  pushButtonEdge(button, timeMicros());
+} // queueButtonEdge()
+
+
+void startButtonInterrupts(void) {
+  uint8_t oldSREG = SREG;
+  cli();
+  __pinbLast = PINB;
+  PCMSK0 = BUTTON_PCINT_MASK;
+  PCIFR  = (1 << PCIF0);
+  PCICR |= (1 << PCIE0);
+  SREG = oldSREG;
+} // startButtonInterrupts()
+
+
+// Pin change interrupt 0 fires on any change of a masked port B pin, either way. Comparing with the last
+// snapshot says which pins changed, and those now low are the falling edges.
+//
+// Cycle counts on the 32U4 at -Os, counted from the code rather than measured:
+//   vector jump and interrupt response                      ~8
+//   prologue and epilogue, r0, r1, SREG and the 12 registers
+//   a call may clobber, with reti                           ~72
+//   PINB read, XOR and masks, snapshot store, branch        ~10
+//   timeMicros(): call, readTicks() with SREG save and cli,
+//   TCNT1, three volatiles, pending overflow test, shifts   ~80
+//   pushButtonEdge(): ring index, full test, button and
+//   4 byte time stores, head store, wakeTasks() call        ~40 each
+// That is about 90 cycles (6 us) for a rising edge, which returns early, and about 210 (13 us) for one falling
+// edge. PinChangeInt paid the same entry and register saves. It then walked its pin list and called each
+// changed pin's handler through a pointer, where stepMode() or stepSpeed() only set a flag with no time on it.
+ISR(PCINT0_vect) {
+  uint8_t pins = PINB;
+  uint8_t falling = (pins ^ __pinbLast) & __pinbLast & BUTTON_PCINT_MASK;
+  __pinbLast = pins;
+  if(!falling)
+    return;
+
+  unsigned long now = timeMicros();
+  if(falling & BUTTON_MODE_PCINT_MASK)
+    pushButtonEdge(BUTTON_MODE, now);
+  if(falling & BUTTON_SPEED_PCINT_MASK)
+    pushButtonEdge(BUTTON_SPEED, now);
+} // ISR()
+
+
+uint8_t updateButtonState(ButtonState *state, boolean edge, boolean down, unsigned long now) {
+  if(state->phase == BUTTON_RELEASED)
+  {
+    if(!edge)
+      return BUTTON_NONE;
+    state->phase = BUTTON_PRESSED;
+    state->press = state->last = now;
+    return BUTTON_PRESS;
+  }
+
+  // Bounce, or the button still down. Either way the press is not over yet.
+  if(edge || down)
+  {
+    if(state->phase == BUTTON_HELD)
+    {
+      if(edge || now - state->last < BUTTON_REPEAT_MS * 1000UL)
+        return BUTTON_NONE;
+      state->last += BUTTON_REPEAT_MS * 1000UL;
+      return BUTTON_REPEAT;
+    }
+
+    state->last = now;
+    if(down && now - state->press >= BUTTON_LONG_MS * 1000UL)
+    {
+      state->phase = BUTTON_HELD;
+      return BUTTON_LONG;
+    }
+    return BUTTON_NONE;
+  }
+
+  // Up, and with no edges for long enough, it is really up.
+  if(state->phase == BUTTON_PRESSED)
+  {
+    if(now - state->last >= BUTTON_RELEASE_MS * 1000UL)
+      state->phase = BUTTON_RELEASED;
+  } else {
+    // Let go after a hold. Time the release from here, and make a long press start over if it bounces back down.
+    state->phase = BUTTON_PRESSED;
+    state->press = state->last = now;
+  }
+  return BUTTON_NONE;
+} // updateButtonState()
+
+
+// The buttons pull to ground.
+static boolean buttonDown(uint8_t button) {
+  switch(button)
+  {
+    case BUTTON_MODE:  return !Pin<PIN_BUTTON_MODE>::read();
+    case BUTTON_SPEED: return !Pin<PIN_BUTTON_SPEED>::read();
+    default:           return !Pin<PIN_BUTTON_LEVEL>::read();
+  }
+} // buttonDown()
+
+
+boolean nextButtonEvent(ButtonEvent *event) {
+  // Queued edges first, in the order they came.
+  while(__edgeTail != __edgeHead)
+  {
+    uint8_t tail = __edgeTail;
+    uint8_t button = __edgeButton[tail];
+    uint8_t oldSREG = SREG;
+    cli();
+    unsigned long time = __edgeTime[tail];
+    SREG = oldSREG;
+    __edgeTail = (tail + 1) & (BUTTON_QUEUE_SIZE - 1);
+
+    // Usually a press or bounce, but a bounce edge can be the first thing to find a long press due.
+    uint8_t kind = updateButtonState(&__buttons[button], true, true, time);
+    if(kind != BUTTON_NONE)
+    {
+      event->button = button;
+      event->kind = kind;
+      event->time = time;
+      return true;
+    }
+  }
+
+  // Then look at the buttons that are still in a press, for holds and releases.
+  unsigned long now = timeMicros();
+  for(uint8_t i = 0; i < BUTTON_COUNT; i++)
+  {
+    ButtonState *state = &__buttons[i];
+    if(state->phase == BUTTON_RELEASED)
+      continue;
+
+    uint8_t kind = updateButtonState(state, false, buttonDown(i), now);
+    if(kind != BUTTON_NONE)
+    {
+      event->button = i;
+      event->kind = kind;
+      event->time = now;
+      return true;
+    }
+  }
+  return false;
+} // nextButtonEvent()
+
+
+boolean buttonsActive(void) {
+  for(uint8_t i = 0; i < BUTTON_COUNT; i++)
+    if(__buttons[i].phase != BUTTON_RELEASED)
+      return true;
+  return __edgeTail != __edgeHead;
+} // buttonsActive()
+
+
+void recordPressLatency(unsigned long pressTime) {
+  unsigned long latency = timeMicros() - pressTime;
+  __latencyCount++;
+  __latencySum += latency;
+  if(latency > __latencyWorst)
+    __latencyWorst = latency;
+} // recordPressLatency()
+
+
+void readPressLatency(uint16_t *presses, unsigned long *average, unsigned long *worst) {
+  *presses = __latencyCount;
+  *average = __latencyCount ? __latencySum / __latencyCount : 0;
+  *worst = __latencyWorst;
+  __latencyCount = 0;
+  __latencySum = 0;
+  __latencyWorst = 0;
+} // readPressLatency()
+
+// End of file.
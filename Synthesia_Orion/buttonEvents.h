@@ -0,0 +1,66 @@
+#ifndef __SYNTHESIA_BUTTON_EVENTS_H
+#define __SYNTHESIA_BUTTON_EVENTS_H
+
+#include <Arduino.h>
+
+// Button events.
+//
+// The button interrupts do nothing but queue the edge with its timeMicros() stamp, in a ring the main loop empties.
+// Interrupts do not nest, so the ISRs are the single producer and the ring needs no lock.
+// Mode and speed share pin change interrupt 0, handled here for just those two pins: one read of the port,
+// an XOR with the last snapshot to find the falling edges, and straight into the ring. The generic
+// PinChangeInt library it replaces walked a list of pins and called through a pointer for each.
+//
+// The main loop debounces and classifies. The first edge of a press is a BUTTON_PRESS at once, so a press acts as
+// soon as it is seen. Further edges are bounce and ignored until the pin has read released for BUTTON_RELEASE_MS.
+// A button still down after BUTTON_LONG_MS gives one BUTTON_LONG, then a BUTTON_REPEAT every BUTTON_REPEAT_MS.
+// There is no lockout window after a press, so quick presses are not lost.
+//
+// updateButtonState() is the whole classifier. It reads only its arguments, so bouncy edge sequences can be fed
+// to it on a desktop: tools/host/button_check.cpp does, through the ISR and nextButtonEvent() as well.
+//
+// The time from each press's edge to the first frame shown after acting on it is kept as the press latency.
+
+#define BUTTON_RELEASE_MS   30 // Released this long before the next edge is a new press
+#define BUTTON_LONG_MS     600
+#define BUTTON_REPEAT_MS   200
+#define BUTTON_POLL_MS      10 // How often a held button is looked at
+#define BUTTON_QUEUE_SIZE    8 // Power of 2
+
+enum {
+  BUTTON_MODE,
+  BUTTON_SPEED,
+  BUTTON_LEVEL,
+  BUTTON_COUNT
+};
+
+enum {
+  BUTTON_NONE,
+  BUTTON_PRESS,
+  BUTTON_LONG,
+  BUTTON_REPEAT
+};
+
+struct ButtonEvent {
+  uint8_t       button;
+  uint8_t       kind;
+  unsigned long time;   // timeMicros() of the edge that started the press
+};
+
+struct ButtonState {
+  uint8_t       phase;  // Released, pressed or held
+  unsigned long press;  // timeMicros() of the press
+  unsigned long last;   // Last edge, last time seen down, or last long or repeat event, depending on phase
+};
+
+void startButtonInterrupts(void);                      // Mode and speed. Level is attached to INT1 in setup().
+void queueButtonEdge(uint8_t button);                  // From the other button ISRs
+uint8_t updateButtonState(ButtonState *state, boolean edge, boolean down, unsigned long now);
+boolean nextButtonEvent(ButtonEvent *event);           // False once there is nothing left to act on
+boolean buttonsActive(void);                           // True while a press is still being followed
+void recordPressLatency(unsigned long pressTime);      // When the first frame after acting on a press is shown
+void readPressLatency(uint16_t *presses, unsigned long *average, unsigned long *worst); // And start over
+
+#endif
+
+// End of file.
@@ -0,0 +1,80 @@
+#include "chargeControl.h"
+#include "pins.h"
+#include "batteryStatus.h"
+#include "powerLimiter.h"
+
+static ChargeState __charger = { CHARGE_UNPLUGGED, 0 };
+
+
+void updateChargeState(ChargeState *state, const ChargeInputs *in) {
+  if(!in->usb)
+  {
+    state->phase = CHARGE_UNPLUGGED;
+    return;
+  }
+
+  // Let USB prove it is staying before asking it for more current.
+  if(state->phase == CHARGE_UNPLUGGED)
+  {
+    state->phase = CHARGE_SETTLING;
+    state->settle = CHARGE_SETTLE_UPDATES;
+  }
+  if(state->phase == CHARGE_SETTLING && state->settle)
+  {
+    state->settle--;
+    return;
+  }
+
+  // Full holds until the charge drops well back, so the charger is not restarted at every dip.
+  if(state->phase == CHARGE_FULL)
+  {
+    if(in->percent >= CHARGE_RECHARGE_PERCENT)
+      return;
+  } else if(in->percent >= CHARGE_FULL_PERCENT) {
+    state->phase = CHARGE_FULL;
+    return;
+  }
+
+  // Top off above the taper point, with a gap before fast charging again.
+  if(in->percent >= CHARGE_TAPER_PERCENT
+    || (state->phase == CHARGE_TOPPING && in->percent >= CHARGE_RESUME_PERCENT))
+  {
+    state->phase = CHARGE_TOPPING;
+    return;
+  }
+
+  if(in->stripOn || in->loadMa > CHARGE_LOAD_LIMIT_MA)
+    state->phase = CHARGE_LIMITED;
+  else
+    state->phase = CHARGE_FAST;
+} // updateChargeState()
+
+
+boolean chargeFast(uint8_t phase) {
+  return phase == CHARGE_FAST;
+} // chargeFast()
+
+
+// A suspended USB interface means nothing is on the other end of the cable.
+boolean usbPowered(void) {
+  return !(UDINT & B00000001);
+} // usbPowered()
+
+
+void updateCharger(boolean stripOn) {
+  ChargeInputs in;
+  in.usb = usbPowered();
+  in.stripOn = stripOn;
+  in.loadMa = stripOn ? stripCurrent() : 0;
+  in.percent = batteryChargePercent();
+
+  updateChargeState(&__charger, &in);
+  Pin<PIN_CHARGE_HIGH>::write(chargeFast(__charger.phase) ? CHARGE_PIN_FAST : CHARGE_PIN_450MA);
+} // updateCharger()
+
+
+uint8_t chargePhase(void) {
+  return __charger.phase;
+} // chargePhase()
+
+// End of file.
@@ -0,0 +1,60 @@
+#ifndef __SYNTHESIA_CHARGE_CONTROL_H
+#define __SYNTHESIA_CHARGE_CONTROL_H
+
+#include <Arduino.h>
+
+// Charge current control.
+//
+// PIN_CHARGE_HIGH picks the charger's current: the 450 mA setting the unit always used to run at, or the fast
+// setting. Fast charging is only safe when USB has the current to spare, so it is only used with the strip off,
+// and it steps back to 450 mA under load and for the top off, where the charger tapers the current anyway.
+//
+//   UNPLUGGED  no USB                                      450 mA, status light shows the battery
+//   SETTLING   USB just attached, waiting for it to stay   450 mA, purple
+//   FAST       USB, strip off, below CHARGE_TAPER_PERCENT  fast,   purple
+//   LIMITED    USB, but the strip or other load is on      450 mA, yellow
+//   TOPPING    USB, at or above CHARGE_TAPER_PERCENT       450 mA, cyan
+//   FULL       USB, charged                                450 mA, white
+//
+// updateChargeState() is the whole decision. It reads nothing but its inputs and changes nothing but its state,
+// so it runs as is on a desktop, driven by a simulated battery and USB attach and detach (tools/host/charge_sim.cpp).
+// updateCharger() fills the inputs in from the hardware and sets the pin.
+
+#define CHARGE_SETTLE_UPDATES     4 // Battery updates USB must stay attached before fast charging, about 1 s
+#define CHARGE_TAPER_PERCENT     90 // Back off to 450 mA from here up...
+#define CHARGE_RESUME_PERCENT    85 // ...and only go fast again below this
+#define CHARGE_FULL_PERCENT     100
+#define CHARGE_RECHARGE_PERCENT  95 // Out of FULL below this
+#define CHARGE_LOAD_LIMIT_MA    100 // Other load on USB above which fast charging would overdraw it
+
+enum {
+  CHARGE_UNPLUGGED,
+  CHARGE_SETTLING,
+  CHARGE_FAST,
+  CHARGE_LIMITED,
+  CHARGE_TOPPING,
+  CHARGE_FULL
+};
+
+struct ChargeInputs {
+  boolean  usb;      // USB power present
+  boolean  stripOn;
+  uint16_t loadMa;   // Everything drawing from USB besides the charger
+  uint8_t  percent;  // Battery charge
+};
+
+struct ChargeState {
+  uint8_t phase;
+  uint8_t settle;    // Updates left in CHARGE_SETTLING
+};
+
+void updateChargeState(ChargeState *state, const ChargeInputs *in);
+boolean chargeFast(uint8_t phase);            // True if the phase charges at the fast setting
+
+void updateCharger(boolean stripOn);          // Call from the battery update, after the gauge
+uint8_t chargePhase(void);
+boolean usbPowered(void);
+
+#endif
+
+// End of file.
@@ -0,0 +1,170 @@
+#include "energyProfile.h"
+#include "orion.h"
+#include "scheduler.h"
+#include "timeBase.h"
+#include "buttonEvents.h"
+#include "powerSequence.h"
+#include "frameSync.h"
+#include "pov.h"
+#include "audioSampler.h"
+#include "batteryStatus.h"
+#include "memoryUsage.h"
+
+#if ENERGY_PROFILE
+
+extern int mode, syspeed, brightness; // orion.cpp
+
+static uint16_t      __shownSum;   // Channel sum of the frame on the strip
+static unsigned long __shownAt;    // timeMillis() it went out
+static unsigned long __sumTime;    // Channel sum times ms, this window
+static unsigned long __windowStart;
+static uint16_t      __frames;
+static unsigned long __reportedPowerOn; // Last powerOnLatency() printed
+static unsigned long __windowSleeps;    // sleepCycles() at the start of the window
+
+
+void startEnergyProfile(void) {
+  Serial.begin(115200);
+  __shownAt = __windowStart = timeMillis();
+} // startEnergyProfile()
+
+
+// The strip keeps drawing the last frame until the next, so each frame's sum counts for the time it was shown.
+void accountFrameEnergy(uint16_t channelSum) {
+  unsigned long now = timeMillis();
+  __sumTime += (unsigned long)__shownSum * (now - __shownAt);
+  __shownSum = channelSum;
+  __shownAt = now;
+  __frames++;
+} // accountFrameEnergy()
+
+
+void reportEnergyProfile(void) {
+  accountFrameEnergy(__shownSum);
+  __frames--;
+
+  unsigned long window = __shownAt - __windowStart;
+  if(window == 0)
+    return;
+
+  // Only with a terminal open on the port. Otherwise every write waits out the USB timeout.
+  if(Serial)
+  {
+    Serial.print("E ");
+    Serial.print(mode);
+    Serial.print(' ');
+    Serial.print(syspeed);
+    Serial.print(' ');
+    Serial.print(brightness);
+    Serial.print(' ');
+    Serial.print(PIXEL_COUNT);
+    Serial.print(' ');
+    Serial.print(__sumTime / window);
+    Serial.print(' ');
+    Serial.print(100 - idleLoad());
+    Serial.print(' ');
+    Serial.print(__frames);
+    Serial.print(' ');
+    Serial.println(sleepCycles() - __windowSleeps);
+
+    Serial.print("M ");
+    Serial.print(mode);
+    Serial.print(' ');
+    Serial.print(modeStateSize(mode));
+    Serial.print(' ');
+    Serial.print(modeArenaSize());
+    Serial.print(' ');
+    Serial.println(stackHeadroom());
+
+    uint16_t presses;
+    unsigned long average, worst;
+    readPressLatency(&presses, &average, &worst);
+    if(presses)
+    {
+      Serial.print("L ");
+      Serial.print(presses);
+      Serial.print(' ');
+      Serial.print(average);
+      Serial.print(' ');
+      Serial.println(worst);
+    }
+
+    uint16_t beacons;
+    readSyncError(&beacons, &average, &worst);
+    if(beacons)
+    {
+      Serial.print("S ");
+      Serial.print(beacons);
+      Serial.print(' ');
+      Serial.print(average);
+      Serial.print(' ');
+      Serial.print(worst);
+      Serial.print(' ');
+      Serial.println(syncTrimPpm());
+    }
+
+    uint16_t columns, earliest, latest, length, late;
+    readPovTiming(&columns, &earliest, &latest, &length, &late);
+    if(columns)
+    {
+      Serial.print("C ");
+      Serial.print(povColumnRate());
+      Serial.print(' ');
+      Serial.print(columns);
+      Serial.print(' ');
+      Serial.print(earliest);
+      Serial.print(' ');
+      Serial.print(latest);
+      Serial.print(' ');
+      Serial.print(length);
+      Serial.print(' ');
+      Serial.println(late);
+    }
+
+    uint16_t overruns = readAudioOverruns();
+    if(overruns)
+    {
+      Serial.print("A ");
+      Serial.println(overruns);
+    }
+
+    if(batteryMillivolts())
+    {
+      Serial.print("B ");
+      Serial.print(batteryMillivolts());
+      Serial.print(' ');
+      Serial.print(batteryChargePercent());
+      Serial.print(' ');
+      Serial.println(batteryMinutesRemaining());
+    }
+
+    if(powerOnLatency() != __reportedPowerOn)
+    {
+      __reportedPowerOn = powerOnLatency();
+      Serial.print("P ");
+      Serial.println(__reportedPowerOn);
+    }
+  }
+
+  __sumTime = 0;
+  __frames = 0;
+  __windowStart = __shownAt;
+  __windowSleeps = sleepCycles();
+} // reportEnergyProfile()
+
+#else
+
+void startEnergyProfile(void) {
+} // startEnergyProfile()
+
+
+void accountFrameEnergy(uint16_t channelSum) {
+} // accountFrameEnergy()
+
+
+void reportEnergyProfile(void) {
+} // reportEnergyProfile()
+
+#endif
+
+// End of file.
@@ -0,0 +1,62 @@
+#ifndef __SYNTHESIA_ENERGY_PROFILE_H
+#define __SYNTHESIA_ENERGY_PROFILE_H
+
+#include <Arduino.h>
+
+// Energy profile capture.
+//
+// With ENERGY_PROFILE set to 1, the unit prints one line a second over USB serial for tools/energy_profile.py:
+//
+//   E <mode> <speed> <brightness> <pixels> <channel sum> <busy %> <frames> <sleeps>
+//
+// channel sum is the strip's sum of channel values (see powerLimiter.h) averaged over the second by time shown,
+// before the power limiter. busy % is the time the CPU was not asleep, and sleeps the times it went to sleep
+// (see timeBase.h): about one a frame when the scheduler has nothing else due. Step through the modes and settings
+// with the buttons while capturing. Seconds with button presses in them add
+//
+//   L <presses> <average us> <worst us>
+//
+// for the time from each press to the first frame shown after acting on it (see buttonEvents.h), and each
+// power on adds
+//
+//   P <us>
+//
+// for the time from the power button to the first frame shown (see powerSequence.h). A sync follower adds
+//
+//   S <beacons> <average us> <worst us> <trim ppm>
+//
+// for the phase error to the leader as each beacon came in (see frameSync.h). While a POV image plays,
+//
+//   C <columns/s> <columns> <earliest> <latest> <longest column> <late columns>
+//
+// gives the column timing (see pov.h), in Timer3 counts of 0.5 us: latest - earliest is the jitter on the
+// start of a column. Seconds where the audio analysis fell behind the microphone add
+//
+//   A <samples dropped>
+//
+// (see audioSampler.h). Once the fuel gauge has a reading,
+//
+//   B <mV> <charge %> <minutes remaining>
+//
+// gives the battery as the gauge sees it, and how long it would last at the draw then: 65535 on USB power
+// (see batteryStatus.h). Each second also gives the running mode's SRAM,
+//
+//   M <mode> <state bytes> <arena bytes> <stack headroom>
+//
+// its share of the mode arena, the arena itself, and the bytes of free SRAM its stack has never reached since it
+// was selected (see memoryUsage.h). The tool turns the capture into current and battery life per mode, setting and pixel count,
+// from the same current model as powerLimiter.h.
+//
+// Off by default: USB serial costs flash, RAM and CPU time the modes would rather have.
+
+#ifndef ENERGY_PROFILE
+#define ENERGY_PROFILE 0
+#endif
+
+void startEnergyProfile(void);
+void accountFrameEnergy(uint16_t channelSum); // Call as each frame is shown
+void reportEnergyProfile(void);               // Call once a second, after updateTaskLoads()
+
+#endif
+
+// End of file.
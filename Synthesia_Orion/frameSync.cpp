@@ -0,0 +1,285 @@
+#include "frameSync.h"
+#include "orion.h"
+#include "timeBase.h"
+#include "scheduler.h"
+
+#if FRAME_SYNC
+
+extern int mode, syspeed; // orion.cpp
+
+#define SYNC_MAGIC_0 'O'
+#define SYNC_MAGIC_1 'S'
+#define SYNC_CHECK   0x55
+
+static uint8_t       __beacon[SYNC_BEACON_SIZE];
+static unsigned long __lastBeacon;    // timeMillis() of the last beacon sent or acted on
+
+static uint8_t beaconCheck(void) {
+  uint8_t check = SYNC_CHECK;
+  for(uint8_t i = 2; i < SYNC_BEACON_SIZE - 1; i++)
+    check ^= __beacon[i];
+  return check;
+} // beaconCheck()
+
+
+#if FRAME_SYNC == FRAME_SYNC_LEADER
+
+static void writeClockBytes(uint8_t *p, uint32_t clock) {
+  for(uint8_t i = 0; i < 4; i++)
+  {
+    p[i] = clock;
+    clock >>= 8;
+  }
+} // writeClockBytes()
+
+
+void startFrameSync(void) {
+  Serial1.begin(SYNC_BAUD);
+} // startFrameSync()
+
+
+boolean updateFrameSync(boolean poweredOn) {
+  if(!poweredOn)
+    return false;
+
+  unsigned long now = timeMillis();
+  if(now - __lastBeacon < SYNC_BEACON_MS)
+  {
+    wakeBy(timeMicros() + (SYNC_BEACON_MS - (now - __lastBeacon)) * 1000UL);
+    return false;
+  }
+  __lastBeacon = now;
+
+  // The transmit buffer is empty by now, so the first byte goes straight out: its start bit is within a bit
+  // time of this timestamp.
+  uint32_t animation, cycles;
+  readAnimationClocks(timeMicros(), &animation, &cycles);
+
+  __beacon[0] = SYNC_MAGIC_0;
+  __beacon[1] = SYNC_MAGIC_1;
+  __beacon[2] = mode;
+  __beacon[3] = syspeed;
+  writeClockBytes(__beacon + 4, animation);
+  writeClockBytes(__beacon + 8, cycles);
+  __beacon[SYNC_BEACON_SIZE - 1] = beaconCheck();
+  Serial1.write(__beacon, SYNC_BEACON_SIZE);
+  return true;
+} // updateFrameSync()
+
+
+#elif FRAME_SYNC == FRAME_SYNC_FOLLOWER
+
+static uint8_t       __received;      // Bytes of the beacon so far
+static boolean       __locked;        // False until the clocks have been set from a beacon
+static long          __slew;          // Microseconds of phase still to slew out
+static long          __slewOffered;   // The part of it in the last syncCorrection()
+static int           __trim;          // Clock rate trim, in units of 1/65536
+
+static volatile unsigned long __edgeMicros; // timeMicros() of the first falling edge on RX since armRxEdge()
+static volatile boolean       __edgeSeen;
+
+static uint16_t      __errorCount;
+static unsigned long __errorSum;
+static unsigned long __errorWorst;
+
+
+static uint32_t readClockBytes(const uint8_t *p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+} // readClockBytes()
+
+
+// The first edge after the line has gone idle is the start bit of the next beacon. Once is enough, so the
+// interrupt turns itself off and the data bits that follow cost nothing.
+static void rxEdge(void) {
+  __edgeMicros = timeMicros();
+  __edgeSeen = true;
+  EIMSK &= ~(1 << INT2);
+} // rxEdge()
+
+
+static void armRxEdge(void) {
+  __edgeSeen = false;
+  EIFR = 1 << INTF2;
+  EIMSK |= 1 << INT2;
+} // armRxEdge()
+
+
+void startFrameSync(void) {
+  Serial1.begin(SYNC_BAUD);
+  // RX is pin 0, INT2. The UART has the pin, but its level still reaches the external interrupt.
+  attachInterrupt(INT2, &rxEdge, FALLING);
+  armRxEdge();
+} // startFrameSync()
+
+
+static void recordSyncError(long errorUs) {
+  unsigned long size = errorUs < 0 ? -errorUs : errorUs;
+  __errorCount++;
+  __errorSum += size;
+  if(size > __errorWorst)
+    __errorWorst = size;
+} // recordSyncError()
+
+
+// Steer the animation clocks toward the leader's, from a beacon whose start bit arrived at edge.
+static void followBeacon(unsigned long edge) {
+  if(__beacon[2] != mode || __beacon[3] != syspeed)
+  {
+    if(__beacon[2] < modeCount())
+      changeMode(__beacon[2]);
+    syspeed = __beacon[3];
+    __locked = false;
+    return;
+  }
+
+  uint32_t rate = animationClockRate();
+  if(!rate)
+    return;
+
+  uint32_t animation, cycles;
+  readAnimationClocks(edge, &animation, &cycles);
+  int32_t error = readClockBytes(__beacon + 4) - animation;
+
+  // Slew still to come is correction already made.
+  long errorUs = error / (int32_t)rate - __slew;
+
+  if(!__locked || errorUs > SYNC_JUMP_US || errorUs < -SYNC_JUMP_US)
+  {
+    setAnimationClocks(edge, readClockBytes(__beacon + 4), readClockBytes(__beacon + 8));
+    __slew = 0;
+    __locked = true;
+    return;
+  }
+
+  recordSyncError(errorUs);
+
+  __slew += errorUs / 2;
+  // errorUs over one beacon period is the frequency error. A quarter of it, in units of 1/65536.
+  long trim = __trim + errorUs * 16384L / (SYNC_BEACON_MS * 1000L);
+  __trim = constrain(trim, -SYNC_TRIM_MAX, SYNC_TRIM_MAX);
+} // followBeacon()
+
+
+boolean updateFrameSync(boolean poweredOn) {
+  boolean acted = false;
+  boolean complete = false;
+
+  if(timeMillis() - __lastBeacon > SYNC_TIMEOUT_MS)
+  {
+    // Keep the trim: the crystals are no closer together for losing the leader.
+    __locked = false;
+    __slew = 0;
+  }
+
+  while(Serial1.available())
+  {
+    uint8_t c = Serial1.read();
+
+    if(__received == 0 && c != SYNC_MAGIC_0)
+      continue;
+    if(__received == 1 && c != SYNC_MAGIC_1)
+    {
+      __received = c == SYNC_MAGIC_0;
+      continue;
+    }
+    __beacon[__received++] = c;
+    if(__received < SYNC_BEACON_SIZE)
+      continue;
+
+    __received = 0;
+    complete = true;
+    unsigned long edge = __edgeMicros;
+    boolean timed = __edgeSeen && timeMicros() - edge < SYNC_EDGE_WINDOW_US;
+    if(poweredOn && timed && __beacon[SYNC_BEACON_SIZE - 1] == beaconCheck())
+    {
+      followBeacon(edge);
+      __lastBeacon = timeMillis();
+      acted = true;
+    }
+  }
+
+  // With a beacon just in and nothing after it, the line is idle until the next one. An edge that has had no
+  // beacon follow it was noise. Either way, ready for the next start bit.
+  if(__received == 0 && !Serial1.available() &&
+     (complete || (__edgeSeen && timeMicros() - __edgeMicros > SYNC_EDGE_WINDOW_US)))
+    armRxEdge();
+  return acted;
+} // updateFrameSync()
+
+
+long syncTrim(long elapsed) {
+  return elapsed * __trim >> 16;
+} // syncTrim()
+
+
+long syncCorrection(unsigned long elapsed) {
+  long limit = elapsed >> 3;
+  __slewOffered = constrain(__slew, -limit, limit);
+  return syncTrim(elapsed) + __slewOffered;
+} // syncCorrection()
+
+
+void syncCorrectionUsed(void) {
+  __slew -= __slewOffered;
+  __slewOffered = 0;
+} // syncCorrectionUsed()
+
+
+void readSyncError(uint16_t *beacons, unsigned long *average, unsigned long *worst) {
+  *beacons = __errorCount;
+  *average = __errorCount ? __errorSum / __errorCount : 0;
+  *worst = __errorWorst;
+  __errorCount = 0;
+  __errorSum = __errorWorst = 0;
+} // readSyncError()
+
+
+// 1/65536 is 15.26 ppm.
+int syncTrimPpm(void) {
+  return (long)__trim * 15625 >> 10;
+} // syncTrimPpm()
+
+#endif
+#endif
+
+#if FRAME_SYNC != FRAME_SYNC_FOLLOWER
+
+long syncTrim(long elapsed) {
+  return 0;
+} // syncTrim()
+
+
+long syncCorrection(unsigned long elapsed) {
+  return 0;
+} // syncCorrection()
+
+
+void syncCorrectionUsed(void) {
+} // syncCorrectionUsed()
+
+
+void readSyncError(uint16_t *beacons, unsigned long *average, unsigned long *worst) {
+  *beacons = 0;
+  *average = *worst = 0;
+} // readSyncError()
+
+
+int syncTrimPpm(void) {
+  return 0;
+} // syncTrimPpm()
+
+#endif
+
+#if !FRAME_SYNC
+
+void startFrameSync(void) {
+} // startFrameSync()
+
+
+boolean updateFrameSync(boolean poweredOn) {
+  return false;
+} // updateFrameSync()
+
+#endif
+
+// End of file.
@@ -0,0 +1,59 @@
+#ifndef __SYNTHESIA_FRAME_SYNC_H
+#define __SYNTHESIA_FRAME_SYNC_H
+
+#include <Arduino.h>
+
+// Frame clock sync between units over the hardware UART (Serial1, pins 0 and 1), so a group of belts animates
+// as one. One unit is built as the leader, the rest as followers. The leader's TX is wired to every follower's
+// RX, and ground to ground. Followers never transmit.
+//
+// While on, the leader sends a beacon every SYNC_BEACON_MS:
+//
+//   'O' 'S' <mode> <speed> <animation clock, 4 bytes> <animation cycles, 4 bytes> <check>
+//
+// The clock is the 16.16 animation clock (see orion.cpp) as of the beacon's first start bit, and the cycles the
+// times it has come round since the mode started, which fix frameStep. Both low byte first.
+// check is the XOR of the bytes from mode to the cycles, and 0x55.
+//
+// A follower timestamps that start bit from the falling edge on RX (INT2, armed only while the line is idle
+// between beacons), so the time a beacon waits in the serial buffer does not count. A follower on another mode
+// or speed switches to the leader's. Otherwise the phase error between the two animation clocks, in
+// microseconds, drives a phase locked loop:
+//   - half of it is slewed out by running the clocks up to 1/8 fast or slow, never as a jump
+//   - a quarter of the frequency error it implies goes into a trim on the follower's clock rate, which soaks up
+//     the difference between the two units' crystals (up to SYNC_TRIM_MAX)
+// Only the first beacon, a mode or speed change, or an error over SYNC_JUMP_US moves the clocks in one go.
+//
+// A beacon costs a follower one edge interrupt, 13 bytes parsed and one 32 bit division. Sync error is the phase
+// error as each beacon arrives; the energy profile reports it (see energyProfile.h).
+// tools/host_checks.py sync builds this file and animationClock.cpp as a leader and several followers on a
+// local bus and measures how closely they keep together.
+//
+// FRAME_SYNC is 0 (off, the default), FRAME_SYNC_LEADER or FRAME_SYNC_FOLLOWER.
+
+#define FRAME_SYNC_LEADER   1
+#define FRAME_SYNC_FOLLOWER 2
+
+#ifndef FRAME_SYNC
+#define FRAME_SYNC 0
+#endif
+
+#define SYNC_BAUD          38400   // 0.2% off at 16 MHz. A beacon takes 3.4 ms.
+#define SYNC_BEACON_MS       250
+#define SYNC_BEACON_SIZE      13
+#define SYNC_TIMEOUT_MS     2000   // Beacons missed for this long and the follower runs free until the next
+#define SYNC_JUMP_US       50000L
+#define SYNC_TRIM_MAX        655   // 1% in units of 1/65536
+#define SYNC_EDGE_WINDOW_US 20000UL // A start bit older than this when its beacon is parsed is not trusted
+
+void startFrameSync(void);
+boolean updateFrameSync(boolean poweredOn);  // Polled. True if a beacon was sent or acted on.
+long syncTrim(long elapsed);                 // The rate trim alone, for reading the clocks between steps
+long syncCorrection(unsigned long elapsed);  // Microseconds to add to elapsed clock time: trim and slew
+void syncCorrectionUsed(void);               // After the clocks have advanced by the last syncCorrection()
+void readSyncError(uint16_t *beacons, unsigned long *average, unsigned long *worst); // us, since the last read
+int syncTrimPpm(void);
+
+#endif
+
+// End of file.
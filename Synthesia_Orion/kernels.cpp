@@ -0,0 +1,127 @@
+#include "kernels.h"
+
+// In-place 2-tap blur. Walks left to right so buf[x+1] is still unmodified when it is read.
+void blur2(byte *buf, uint8_t n) {
+  if(n == 0)
+    return;
+
+  byte current = *buf;
+  while(--n) {
+    byte next = buf[1];
+    *buf++ = ((uint16_t)current + next) >> 1;
+    current = next;
+  }
+  // The last pixel has no right neighbour and blurs with itself, so it is left as is.
+} // blur2()
+
+
+// Ping-pong 2-tap blur from src into dst.
+void blur2(const byte *src, byte *dst, uint8_t n) {
+  if(n == 0)
+    return;
+
+  byte current = *src++;
+  while(--n) {
+    byte next = *src++;
+    *dst++ = ((uint16_t)current + next) >> 1;
+    current = next;
+  }
+  *dst = current;
+} // blur2()
+
+
+// In-place [1 2 1] blur. The left and right neighbours are clamped to the end pixels.
+void blur3(byte *buf, uint8_t n) {
+  if(n == 0)
+    return;
+
+  byte previous = *buf;
+  byte current  = *buf;
+  while(n--) {
+    byte next = n ? buf[1] : current;
+    *buf++ = ((uint16_t)previous + current + current + next) >> 2;
+    previous = current;
+    current  = next;
+  }
+} // blur3()
+
+
+// Subtract amount from every pixel, stopping at zero.
+void decay(byte *buf, uint8_t n, byte amount) {
+  if(n == 0)
+    return;
+
+#if defined(__AVR__)
+  asm volatile(
+    "1: ld   __tmp_reg__, %a0  \n\t"
+    "   sub  __tmp_reg__, %2   \n\t"
+    "   brcc 2f                \n\t"
+    "   clr  __tmp_reg__       \n\t"
+    "2: st   %a0+, __tmp_reg__ \n\t"
+    "   dec  %1                \n\t"
+    "   brne 1b                \n\t"
+    : "+e" (buf), "+r" (n)
+    : "r" (amount)
+    : "memory"
+  );
+#else
+  while(n--) {
+    byte v = *buf;
+    *buf++ = v > amount ? v - amount : 0;
+  }
+#endif
+} // decay()
+
+
+// Scale every pixel by scale/256. Repeated calls give an exponential fall off.
+void fade(byte *buf, uint8_t n, byte scale) {
+  if(n == 0)
+    return;
+
+#if defined(__AVR__)
+  // The high byte of the 8x8 product lands in r1, which must be cleared again afterwards.
+  asm volatile(
+    "1: ld   __tmp_reg__, %a0  \n\t"
+    "   mul  __tmp_reg__, %2   \n\t"
+    "   st   %a0+, r1          \n\t"
+    "   dec  %1                \n\t"
+    "   brne 1b                \n\t"
+    "   clr  __zero_reg__      \n\t"
+    : "+e" (buf), "+r" (n)
+    : "r" (scale)
+    : "r0", "memory"
+  );
+#else
+  while(n--) {
+    *buf = ((uint16_t)*buf * scale) >> 8;
+    buf++;
+  }
+#endif
+} // fade()
+
+
+// Heat drifts away from pixel 0 and diffuses a little.
+// Walks from the far end back so every read still sees the previous frame's values.
+void diffuseHeat(byte *heat, uint8_t n) {
+  if(n < 2)
+    return;
+
+  for(uint8_t x = n - 1; x >= 2; x--) {
+    // (a + 2b) / 3 as a multiply and shift; 85/256 is close enough to 1/3 for a flame.
+    uint16_t sum = (uint16_t)heat[x - 1] + heat[x - 2] + heat[x - 2];
+    heat[x] = (sum * 85) >> 8;
+  }
+  heat[1] = ((uint16_t)heat[1] + heat[0]) >> 1;
+} // diffuseHeat()
+
+
+// Add amount at pos, saturating at 255. Out of range positions are ignored.
+void addSpark(byte *buf, uint8_t n, uint8_t pos, byte amount) {
+  if(pos >= n)
+    return;
+
+  byte v = buf[pos] + amount;
+  buf[pos] = v < amount ? 255 : v;
+} // addSpark()
+
+// End of file.
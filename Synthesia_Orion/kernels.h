@@ -0,0 +1,28 @@
+#ifndef __SYNTHESIA_KERNELS_H
+#define __SYNTHESIA_KERNELS_H
+
+#include <Arduino.h>
+
+// 1D kernels over byte buffers (one byte per pixel) for sparkle, fire, comet-tail and glow effects.
+// Every kernel works in place and is bounds safe: nothing outside buf[0..n-1] is ever read or written.
+// The end pixels reuse their own value where a neighbour would be off the end of the buffer.
+//
+// Cycle counts are per pixel on the 32U4 at -Os, counted from the inner loop instructions.
+// blur2()        ~14 cycles   2-tap box blur, (buf[x] + buf[x+1]) / 2
+// blur3()        ~20 cycles   3-tap [1 2 1] / 4 blur, softer glow
+// decay()         10 cycles   Linear decay, saturating subtract (inline asm)
+// fade()           9 cycles   Exponential decay, buf[x] * scale / 256 (inline asm)
+// diffuseHeat()  ~24 cycles   Fire heat drift, heat[x] = (heat[x-1] + 2*heat[x-2]) / 3
+// addSpark()      constant    Saturating add at a single position
+
+void blur2(byte *buf, uint8_t n);
+void blur2(const byte *src, byte *dst, uint8_t n); // Ping-pong variant, src and dst must not overlap.
+void blur3(byte *buf, uint8_t n);
+void decay(byte *buf, uint8_t n, byte amount);
+void fade(byte *buf, uint8_t n, byte scale);
+void diffuseHeat(byte *heat, uint8_t n);
+void addSpark(byte *buf, uint8_t n, uint8_t pos, byte amount);
+
+#endif
+
+// End of file.
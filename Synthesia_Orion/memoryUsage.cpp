@@ -0,0 +1,50 @@
+#include "memoryUsage.h"
+
+#define STACK_PAINT  0xC5
+#define STACK_MARGIN 32 // Left unpainted below the caller's frame, for the calls made from here on
+
+#if defined(__AVR__)
+extern uint8_t __heap_start;
+extern void   *__brkval;
+
+// Bottom of the free SRAM: the top of the heap if malloc() has ever been used, otherwise the end of .bss.
+static uint8_t *freeMemoryStart(void) {
+  return __brkval ? (uint8_t *)__brkval : &__heap_start;
+} // freeMemoryStart()
+#endif
+
+
+void resetStackHeadroom(void) {
+#if defined(__AVR__)
+  // An interrupt taken while painting would push its frame into the area being painted.
+  uint8_t oldSREG = SREG;
+  cli();
+
+  uint8_t *p   = freeMemoryStart();
+  uint8_t *top = (uint8_t *)SP - STACK_MARGIN;
+  while(p < top)
+    *p++ = STACK_PAINT;
+
+  SREG = oldSREG;
+#endif
+} // resetStackHeadroom()
+
+
+uint16_t stackHeadroom(void) {
+#if defined(__AVR__)
+  uint8_t *p   = freeMemoryStart();
+  uint8_t *top = (uint8_t *)SP;
+  uint16_t untouched = 0;
+
+  while(p < top && *p == STACK_PAINT)
+  {
+    p++;
+    untouched++;
+  }
+  return untouched;
+#else
+  return 0;
+#endif
+} // stackHeadroom()
+
+// End of file.
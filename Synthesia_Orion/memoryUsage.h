@@ -0,0 +1,23 @@
+#ifndef __SYNTHESIA_MEMORY_USAGE_H
+#define __SYNTHESIA_MEMORY_USAGE_H
+
+#include <Arduino.h>
+
+// SRAM footprint at run time.
+//
+// The 32U4 has 2.5 KB of SRAM. Globals and the mode arena are fixed at link time (avr-size shows them as
+// .data + .bss). The only heap use is the strip's pixel buffer, allocated once at start up.
+// Everything above that up to the top of RAM is the stack.
+// The peak footprint of a mode is therefore the fixed part plus the deepest its stack ever reaches.
+//
+// resetStackHeadroom() fills the free SRAM below the stack with a marker, and stackHeadroom() counts how much
+// of it is still untouched. startMode() repaints on every mode change, so the reading is for the current mode.
+// If it gets near 0 after PIXEL_COUNT is raised, the stack is about to run into the globals.
+// The energy profile prints it each second with the mode's state and arena size (see energyProfile.h).
+
+void resetStackHeadroom(void);
+uint16_t stackHeadroom(void); // Bytes the stack has never reached since the last reset
+
+#endif
+
+// End of file.
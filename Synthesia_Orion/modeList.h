@@ -0,0 +1,53 @@
+#ifndef __SYNTHESIA_MODE_LIST_H
+#define __SYNTHESIA_MODE_LIST_H
+
+/*
+ The modes compiled into this build, in the order the mode button steps through them.
+
+ Each entry is MODE(frame, init, framePeriod, stateSize, powerClass, lowestQuality):
+ frame        Draws one frame per call (see modeThread.h).
+ init         Called once when the mode is selected, with a pointer to its (zeroed) state, or NULL.
+ framePeriod  Nominal milliseconds per frame at speed setting 1. Slow modes use a low value (1-5), fast modes a high one (5+).
+ stateSize    Bytes of state the mode keeps between frames. This is the SRAM the mode needs on top of the fixed globals.
+              All modes share one arena the size of the largest entry. Of these only HeatState and PlaybackState
+              grow with PIXEL_COUNT.
+ powerClass   Expected current draw, POWER_LOW, POWER_MEDIUM or POWER_HIGH.
+ lowestQuality  The lowest render quality the mode implements (see renderQuality in orion.h). QUALITY_FULL if it has no cheaper path.
+
+ To build a product with a different set of modes, define ORION_MODE_LIST before this file is included
+ (or edit the list below). Modes left out are not referenced anywhere, so the linker drops their code from flash.
+ Additional modes that can be listed: solidColor, rainbowCycle, pulseStrobe, canada, canada2.
+ playback plays animationData.h (see animation.h). Its framePeriod should be the period the animation was
+ encoded with. pov plays povData.h from a timer (see pov.h). Its framePeriod only sets how soon it restarts after
+ power on.
+*/
+
+#ifndef ORION_MODE_LIST
+#define ORION_MODE_LIST(MODE) \
+  MODE(rainbow,           NULL,               1,  0,                                  POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(rainbowBreathing,  NULL,               1,  sizeof(BreathingState),             POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(plasma,            NULL,              20,  0,                                  POWER_MEDIUM, QUALITY_HALF)  \
+  MODE(splitColorBuilder, NULL,               5,  0,                                  POWER_HIGH,   QUALITY_FULL)  \
+  MODE(smoothColors,      NULL,               5,  0,                                  POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(colorChase,        NULL,               5,  sizeof(ColorState),                 POWER_LOW,    QUALITY_FULL)  \
+  MODE(colorWipe,         NULL,               5,  sizeof(ColorState),                 POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(dither,            NULL,               8,  sizeof(DitherState),                POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(scanner,           NULL,               5,  sizeof(ScannerState),               POWER_LOW,    QUALITY_FULL)  \
+  MODE(wave,              NULL,               5,  sizeof(ColorState),                 POWER_HIGH,   QUALITY_FULL)  \
+  MODE(randomSparkle,     NULL,               3,  0,                                  POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(fadeInOut,         NULL,               1,  sizeof(ColorState),                 POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(sparkler,          NULL,              10,  sizeof(HeatState),                  POWER_LOW,    QUALITY_FULL)  \
+  MODE(fire,              NULL,               6,  sizeof(HeatState),                  POWER_HIGH,   QUALITY_FULL)  \
+  MODE(lava,              NULL,               4,  sizeof(DriftState),                 POWER_MEDIUM, QUALITY_HALF)  \
+  MODE(ocean,             NULL,               4,  sizeof(DriftState),                 POWER_MEDIUM, QUALITY_HALF)  \
+  MODE(fireworks,         resetParticles,     3,  sizeof(ParticlePool),               POWER_LOW,    QUALITY_FULL)  \
+  MODE(meteorShower,      resetParticles,     3,  sizeof(MeteorState),                POWER_LOW,    QUALITY_FULL)  \
+  MODE(audioRainbow,      startAudioMode,     1,  sizeof(SurgeState),                 POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(audioSpectrum,     startAudioMode,     1,  sizeof(SpectrumState),              POWER_MEDIUM, QUALITY_FULL)  \
+  MODE(playback,          startPlayback,     20,  sizeof(PlaybackState),              POWER_LOW,    QUALITY_FULL)  \
+  MODE(pov,               NULL,              20,  0,                                  POWER_MEDIUM, QUALITY_FULL)
+#endif
+
+#endif
+
+// End of file.
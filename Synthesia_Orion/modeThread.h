@@ -0,0 +1,45 @@
+#ifndef __SYNTHESIA_MODE_THREAD_H
+#define __SYNTHESIA_MODE_THREAD_H
+
+#include <Arduino.h>
+
+/*
+ Resumable modes, in the style of protothreads (stackless coroutines).
+
+ Every mode draws exactly one frame per call and returns. updateOrion() then shows the frame and
+ goes back to the main loop, so buttons and the battery monitor are never held up by an animation.
+ A mode that needs several frames in a fixed order can still be written as straight-line code:
+
+   void myMode() {
+     MODE_BEGIN(&modeThread);
+     for(myState.i = 0; myState.i < PIXEL_COUNT; myState.i++) {
+       setPixelAtBrightness(myState.i, c);
+       YIELD_FRAME();           // Show this frame. The next call carries on from here.
+     }
+     MODE_END();                // Start again from the top on the next call.
+   }
+
+ Rules, as for any protothread:
+ - Local variables do not survive a YIELD_FRAME(). Anything needed afterwards goes in the mode's state.
+ - Declarations with an initializer must sit inside their own { } block if a YIELD_FRAME() follows in the same scope.
+ - No switch statements between MODE_BEGIN() and MODE_END(). Call a helper function instead.
+ - The call that resumes after the last YIELD_FRAME() and reaches MODE_END() draws nothing new,
+   so the last frame is shown once more. Loop forever inside the mode if that is not wanted.
+ Modes that only ever draw a single frame do not need any of this.
+*/
+
+struct ModeThread {
+  uint16_t lc; // Line to resume from. 0 is the start of the mode.
+};
+
+#define MODE_RESTART(mt)  ((mt)->lc = 0)
+
+#define MODE_BEGIN(mt)    ModeThread *__modeThread = (mt); switch(__modeThread->lc) { case 0:
+
+#define YIELD_FRAME()     do { __modeThread->lc = __LINE__; return; case __LINE__:; } while(0)
+
+#define MODE_END()        } __modeThread->lc = 0
+
+#endif
+
+// End of file.
@@ -0,0 +1,236 @@
+#include "noise.h"
+#include "pins.h"
+
+// Ken Perlin's reference permutation of 0-255. Used both as the lattice hash and for value noise.
+PROGMEM prog_uchar __noisePermutation[] = {
+  151,160,137, 91, 90, 15,131, 13,201, 95, 96, 53,194,233,  7,225,
+  140, 36,103, 30, 69,142,  8, 99, 37,240, 21, 10, 23,190,  6,148,
+  247,120,234, 75,  0, 26,197, 62, 94,252,219,203,117, 35, 11, 32,
+   57,177, 33, 88,237,149, 56, 87,174, 20,125,136,171,168, 68,175,
+   74,165, 71,134,139, 48, 27,166, 77,146,158,231, 83,111,229,122,
+   60,211,133,230,220,105, 92, 41, 55, 46,245, 40,244,102,143, 54,
+   65, 25, 63,161,  1,216, 80, 73,209, 76,132,187,208, 89, 18,169,
+  200,196,135,130,116,188,159, 86,164,100,109,198,173,186,  3, 64,
+   52,217,226,250,124,123,  5,202, 38,147,118,126,255, 82, 85,212,
+  207,206, 59,227, 47, 16, 58, 17,182,189, 28, 42,223,183,170,213,
+  119,248,152,  2, 44,154,163, 70,221,153,101,155,167, 43,172,  9,
+  129, 22, 39,253, 19, 98,108,110, 79,113,224,232,178,185,112,104,
+  218,246, 97,228,251, 34,242,193,238,210,144, 12,191,179,162,241,
+   81, 51,145,235,249, 14,239,107, 49,192,214, 31,181,199,106,157,
+  184, 84,204,176,115,121, 50, 45,127,  4,150,254,138,236,205, 93,
+  222,114, 67, 29, 24, 72,243,141,128,195, 78, 66,215, 61,156,180
+};
+
+static uint16_t __randomState = 0xACE1; // Any non-zero value; replaced by seedRandom().
+
+
+// Mix the low bits of a few hundred ADC readings of the floating sense pins into the generator.
+// Call once at startup, after the ADC reference has been selected and before anything starts the audio sampler
+// or aux conversions. It is the one analogRead() user audioSampler.h allows.
+void seedRandom(void) {
+  uint16_t seed = 0;
+
+  for(uint8_t i = 0; i < 128; i++) {
+    int v = analogRead((i & 1) ? PIN_NOISE_SENSE_B : PIN_NOISE_SENSE_A);
+    seed = (seed << 3) | (seed >> 13); // Rotate so every reading lands on different bits.
+    seed ^= v;
+  }
+
+  // xorshift never leaves zero, so a dead ADC must not be allowed to produce it.
+  __randomState ^= seed;
+  if(__randomState == 0)
+    __randomState = 0xACE1;
+} // seedRandom()
+
+
+// 16-bit xorshift, shifts (7, 9, 8). Full period of 65535.
+uint16_t random16(void) {
+  uint16_t x = __randomState;
+  x ^= x << 7;
+  x ^= x >> 9;
+  x ^= x << 8;
+  __randomState = x;
+  return x;
+} // random16()
+
+
+uint16_t random16(uint16_t lim) {
+  return ((uint32_t)random16() * lim) >> 16;
+} // random16()
+
+
+uint16_t random16(uint16_t low, uint16_t high) {
+  return low + random16(high - low);
+} // random16()
+
+
+// The high byte is the best mixed half of the xorshift state.
+uint8_t random8(void) {
+  return random16() >> 8;
+} // random8()
+
+
+// Mapped from all 16 bits. With only 8, some results of random8(200) would come up twice as often as others.
+uint8_t random8(uint8_t lim) {
+  return random16(lim);
+} // random8()
+
+
+uint8_t random8(uint8_t low, uint8_t high) {
+  return low + random8(high - low);
+} // random8()
+
+
+#define P(i) pgm_read_byte(&__noisePermutation[(uint8_t)(i)])
+
+// Smoothstep 3t^2 - 2t^3, so the noise has no visible creases at the lattice points.
+static uint8_t ease8(uint8_t t) {
+  uint16_t t2 = ((uint16_t)t * t) >> 8;
+  return (t2 * (768 - 2 * (uint16_t)t)) >> 8;
+} // ease8()
+
+
+static uint16_t ease16(uint16_t t) {
+  uint32_t t2 = ((uint32_t)t * t) >> 16;
+  return (t2 * ((196608UL - 2 * (uint32_t)t) >> 2)) >> 14;
+} // ease16()
+
+
+static int16_t lerp8(int16_t a, int16_t b, uint8_t t) {
+  return a + (int16_t)(((int32_t)(b - a) * t) >> 8);
+} // lerp8()
+
+
+static int32_t lerp16(int32_t a, int32_t b, uint16_t t) {
+  // Halve the span first so a full 16-bit swing times t still fits in 32 bits.
+  return a + ((((b - a) >> 1) * (int32_t)t) >> 15);
+} // lerp16()
+
+
+// Gradient slopes for 1D noise: +-1 and +-1/2.
+static int32_t grad1(uint8_t hash, int32_t d) {
+  switch(hash & 3) {
+    case 0:  return  d;
+    case 1:  return -d;
+    case 2:  return  d >> 1;
+    default: return -(d >> 1);
+  }
+} // grad1()
+
+
+// Gradients for 2D noise: the four diagonals and the four axes.
+static int32_t grad2(uint8_t hash, int32_t dx, int32_t dy) {
+  switch(hash & 7) {
+    case 0:  return  dx + dy;
+    case 1:  return  dx - dy;
+    case 2:  return -dx + dy;
+    case 3:  return -dx - dy;
+    case 4:  return  dx;
+    case 5:  return -dx;
+    case 6:  return  dy;
+    default: return -dy;
+  }
+} // grad2()
+
+
+// Clip the raw noise to the output range and centre it.
+static uint8_t finish8(int16_t n) {
+  return constrain(n, -128, 127) + 128;
+} // finish8()
+
+
+static uint16_t finish16(int32_t n) {
+  return constrain(n, -32768L, 32767L) + 32768L;
+} // finish16()
+
+
+uint8_t inoise8(uint16_t x) {
+  uint8_t X  = x >> 8;
+  uint8_t fx = x;
+  int16_t d0 = fx >> 1;  // Distance from the left lattice point, 0 to 127
+  int16_t d1 = d0 - 128; // Distance from the right lattice point, -128 to -1
+
+  // 1D gradient noise peaks at half a cell, so double it to use the full range.
+  int16_t n = lerp8(grad1(P(X), d0), grad1(P(X + 1), d1), ease8(fx));
+  return finish8(n << 1);
+} // inoise8()
+
+
+uint8_t inoise8(uint16_t x, uint16_t y) {
+  uint8_t X  = x >> 8, Y  = y >> 8;
+  uint8_t fx = x,      fy = y;
+  int16_t dx0 = fx >> 1, dx1 = dx0 - 128;
+  int16_t dy0 = fy >> 1, dy1 = dy0 - 128;
+  uint8_t A = P(X) + Y, B = P(X + 1) + Y;
+  uint8_t u = ease8(fx);
+
+  int16_t n0 = lerp8(grad2(P(A    ), dx0, dy0), grad2(P(B    ), dx1, dy0), u);
+  int16_t n1 = lerp8(grad2(P(A + 1), dx0, dy1), grad2(P(B + 1), dx1, dy1), u);
+  return finish8(lerp8(n0, n1, ease8(fy)));
+} // inoise8()
+
+
+uint16_t inoise16(uint32_t x) {
+  uint8_t  X  = x >> 16;
+  uint16_t fx = x;
+  int32_t  d0 = fx >> 2, d1 = d0 - 16384; // Quarter scale keeps every lerp inside 32 bits.
+
+  int32_t n = lerp16(grad1(P(X), d0), grad1(P(X + 1), d1), ease16(fx));
+  return finish16(n << 2);
+} // inoise16()
+
+
+uint16_t inoise16(uint32_t x, uint32_t y) {
+  uint8_t  X  = x >> 16, Y  = y >> 16;
+  uint16_t fx = x,       fy = y;
+  int32_t  dx0 = fx >> 2, dx1 = dx0 - 16384;
+  int32_t  dy0 = fy >> 2, dy1 = dy0 - 16384;
+  uint8_t  A = P(X) + Y, B = P(X + 1) + Y;
+  uint16_t u = ease16(fx);
+
+  int32_t n0 = lerp16(grad2(P(A    ), dx0, dy0), grad2(P(B    ), dx1, dy0), u);
+  int32_t n1 = lerp16(grad2(P(A + 1), dx0, dy1), grad2(P(B + 1), dx1, dy1), u);
+  return finish16(lerp16(n0, n1, ease16(fy)) << 1);
+} // inoise16()
+
+
+uint8_t vnoise8(uint16_t x) {
+  uint8_t X = x >> 8;
+  return lerp8(P(X), P(X + 1), ease8(x));
+} // vnoise8()
+
+
+uint8_t vnoise8(uint16_t x, uint16_t y) {
+  uint8_t X = x >> 8, Y = y >> 8;
+  uint8_t A = P(X) + Y, B = P(X + 1) + Y;
+  uint8_t u = ease8(x);
+
+  int16_t n0 = lerp8(P(A    ), P(B    ), u);
+  int16_t n1 = lerp8(P(A + 1), P(B + 1), u);
+  return lerp8(n0, n1, ease8(y));
+} // vnoise8()
+
+
+// 16-bit lattice values are built from two hashes of the cell.
+static uint16_t value16(uint8_t h) {
+  return ((uint16_t)P(h) << 8) | P(h ^ 0x5A);
+} // value16()
+
+
+uint16_t vnoise16(uint32_t x) {
+  uint8_t X = x >> 16;
+  return lerp16(value16(X), value16(X + 1), ease16(x));
+} // vnoise16()
+
+
+uint16_t vnoise16(uint32_t x, uint32_t y) {
+  uint8_t  X = x >> 16, Y = y >> 16;
+  uint8_t  A = P(X) + Y, B = P(X + 1) + Y;
+  uint16_t u = ease16(x);
+
+  int32_t n0 = lerp16(value16(P(A    )), value16(P(B    )), u);
+  int32_t n1 = lerp16(value16(P(A + 1)), value16(P(B + 1)), u);
+  return lerp16(n0, n1, ease16(y));
+} // vnoise16()
+
+// End of file.
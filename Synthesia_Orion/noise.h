@@ -0,0 +1,42 @@
+#ifndef __SYNTHESIA_NOISE_H
+#define __SYNTHESIA_NOISE_H
+
+#include <Arduino.h>
+
+// Fast random numbers and gradient noise for the random and organic modes.
+//
+// The generator is a 16-bit xorshift. A call is a handful of shifts and XORs, against a 32-bit
+// multiply and a 32-bit modulo for Arduino random(). Ranges are mapped with a multiply and shift
+// rather than a modulo, so random8(n) and random16(n) never divide.
+// The sequence is seeded from ADC noise on the unconnected sense pins.
+// tools/host_checks.py noise runs the statistical checks and times each function against random().
+//
+// Noise coordinates are fixed point: 8.8 for the 8-bit functions and 16.16 for the 16-bit ones.
+// The integer part selects the lattice cell and the fraction the position inside it, so stepping
+// x by 256 (or 65536) moves one whole cell. Smaller steps give smoother, slower features.
+// Results are centred on 128 (or 32768) and use the full output range.
+
+void seedRandom(void);
+
+uint8_t  random8(void);
+uint8_t  random8(uint8_t lim);                  // 0 to lim-1
+uint8_t  random8(uint8_t low, uint8_t high);    // low to high-1
+uint16_t random16(void);
+uint16_t random16(uint16_t lim);                // 0 to lim-1
+uint16_t random16(uint16_t low, uint16_t high); // low to high-1
+
+// Perlin gradient noise.
+uint8_t  inoise8(uint16_t x);
+uint8_t  inoise8(uint16_t x, uint16_t y);
+uint16_t inoise16(uint32_t x);
+uint16_t inoise16(uint32_t x, uint32_t y);
+
+// Value noise. Cheaper than gradient noise but blockier.
+uint8_t  vnoise8(uint16_t x);
+uint8_t  vnoise8(uint16_t x, uint16_t y);
+uint16_t vnoise16(uint32_t x);
+uint16_t vnoise16(uint32_t x, uint32_t y);
+
+#endif
+
+// End of file.
@@ -1,34 +1,100 @@
 #include "orion.h"
 #include "gamma.h"
 #include "LPD8806.h"
+#include "kernels.h"
+#include "noise.h"
+#include "particles.h"
+#include "audioSampler.h"
+#include "audioAnalysis.h"
+#include "modeThread.h"
+#include "modeList.h"
+#include "timeBase.h"
+#include "memoryUsage.h"
+#include "transition.h"
+#include "powerLimiter.h"
+#include "energyProfile.h"
+#include "telemetryLog.h"
+#include "buttonEvents.h"
+#include "settings.h"
+#include "serialStream.h"
+#include "animation.h"
+#include "animationData.h"
+#include "frameSync.h"
+#include "pov.h"
+#include "povData.h"
 
-byte stripBufferA[PIXEL_COUNT];
-byte stripBufferB[PIXEL_COUNT];
-
-boolean brightnessSemaphore = false;
-boolean speedSemaphore = false;
-boolean modeSemaphore = false;
-
-int animationStep; // Used for incrementing animations (0-384)
-int frameStep;     // Used to increment frame counts.
 int mode;          // System mode
 int syspeed;         // System animation speed control
 int brightness;    // System brightness control
+byte renderQuality; // Level of detail the current mode draws at, QUALITY_FULL or lower
 
 LPD8806 strip = LPD8806(PIXEL_COUNT);
 
-void stepMode(void) {
-  modeSemaphore = true;  
-} // stepMode()
-
-void stepSpeed(void) {
-  speedSemaphore = true;
-} // stepSpeed()
-
+// Most steps of a simulation a mode runs to catch up on dropped frames, so a long stall is not a long frame.
+#define MAX_CATCH_UP_STEPS 4
+
+// Set by renderFrame() until showFrame() has sent the frame.
+static boolean frameReady = false;
+static unsigned long renderTime; // Microseconds renderFrame() spent on the waiting frame
+
+// Frames in a row with plenty of slack before renderQuality steps back up.
+#define QUALITY_HOLD_FRAMES 32
+
+ModeThread modeThread; // Resume point of the running mode (see modeThread.h).
+
+// Per mode state. Everything a mode keeps between frames goes in one of these, never in a static.
+// Only the running mode's state exists, in the shared mode arena below.
+struct ColorState     { uint32_t color; };                      // Modes which cycle through colors
+struct BreathingState { int shifter; };                         // rainbowBreathing()
+struct DitherState    { int i, hiBit; uint32_t color; };        // dither()
+struct ScannerState   { uint32_t color; int step; };            // scanner(), canada(), canada2()
+struct HeatState      { byte heat[PIXEL_COUNT]; };              // Per pixel intensity/heat for sparkler() and fire()
+struct DriftState     { uint16_t drift; };                      // lava(), ocean()
+struct MeteorState    { ParticlePool pool; uint16_t pos; byte hue; }; // meteorShower(). The pool must come first.
+struct SurgeState     { int surge; };                           // audioRainbow()
+struct SpectrumState  { uint16_t hue; };                        // audioSpectrum()
+struct PlaybackState  { AnimationPlayer player; byte pixels[PIXEL_COUNT * 3]; }; // playback(). The frame it decodes into.
+
+// The mode table, built from ORION_MODE_LIST in modeList.h. Only listed modes are linked in.
+#define MODE_DESCRIPTOR(frame, init, period, state, power, quality) { frame, init, period, state, power, quality },
+const ModeDescriptor modeTable[] PROGMEM = {
+  ORION_MODE_LIST(MODE_DESCRIPTOR)
+};
+#undef MODE_DESCRIPTOR
+
+#define MODE_ID(frame, init, period, state, power, quality) MODE_ID_##frame,
+enum {
+  ORION_MODE_LIST(MODE_ID)
+  MODE_COUNT
+};
+#undef MODE_ID
+
+// The mode arena. One block of SRAM shared by every mode, sized at compile time to the largest stateSize
+// in the mode list. It is cleared on every mode change, so a mode always starts from zeroed state.
+#define MODE_ARENA_MEMBER(frame, init, period, state, power, quality) byte frame##State[(state) ? (state) : 1];
+static union {
+  ORION_MODE_LIST(MODE_ARENA_MEMBER)
+  uint32_t align;
+} modeArena;
+#undef MODE_ARENA_MEMBER
+
+#define MODE_STATE(type) (*(type *)&modeArena)
+
+// Press acted on whose result has not been shown yet, for the press latency.
+static boolean pressPending = false;
+static unsigned long pressTime;
+
+// Brightness button interrupt. Mode and speed are queued by buttonEvents.cpp's own pin change ISR.
+// Debouncing and acting on the press happen in updateControls(), see buttonEvents.h.
 void stepBrightness(void) {
-  brightnessSemaphore = true;
+  queueButtonEdge(BUTTON_LEVEL);
 } // stepBrightness()
 
+void powerUpStrip(void) {
+  strip.powerUp();
+} // powerUpStrip()
+
+
 void enable(boolean setBegun) {
   strip.enable(setBegun);
 } // enable()
@@ -49,8 +115,8 @@ boolean isDisabled(void) {
 } // isDisabled()
 
 
-// Set pixel at globalBrightness
-void setPixelAtBrightness(int i, uint32_t c)
+// Scale a color to the global brightness
+uint32_t colorAtBrightness(uint32_t c)
 {
    int  r, g, b;
   
@@ -107,7 +173,50 @@ void setPixelAtBrightness(int i, uint32_t c)
      default: break;
   }
   
-  strip.setPixelColor(i, r, g, b); 
+  return(strip.Color(r, g, b));
+}
+
+
+// Set pixel at globalBrightness
+void setPixelAtBrightness(int i, uint32_t c)
+{
+  strip.setPixelColor(i, colorAtBrightness(c));
+}
+
+
+// Add a color at level/256 intensity on top of what the pixel already holds, at globalBrightness.
+// Channels saturate rather than wrap, so overlapping sparks blend towards white.
+void addPixelAtBrightness(int i, uint32_t c, byte level)
+{
+  if(i < 0 || i >= strip.numPixels())
+    return;
+
+  uint32_t d   = colorAtBrightness(c);
+  uint32_t old = strip.getPixelColor(i);
+  int  r, g, b;
+
+  g = ((old >> 16) & 0x7f) + ((((d >> 16) & 0x7f) * level) >> 8);
+  r = ((old >>  8) & 0x7f) + ((((d >>  8) & 0x7f) * level) >> 8);
+  b = ( old        & 0x7f) + ((( d        & 0x7f) * level) >> 8);
+
+  strip.setPixelColor(i, min(r, 127), min(g, 127), min(b, 127));
+}
+
+
+// Draw every live particle, anti-aliased across the two pixels it sits between.
+// Only touches live particles, so the mode is responsible for clearing or fading the strip.
+void drawParticles()
+{
+  for(uint8_t i = 0; i < particles->count; i++)
+  {
+    int      pixel = particles->pos[i] >> 8;
+    byte     frac  = particles->pos[i] & 0xff;
+    byte     life  = particles->life[i];
+    uint32_t c     = Wheel(((uint16_t)particles->hue[i] * 3) >> 1);
+
+    addPixelAtBrightness(pixel,     c, ((uint16_t)life * (255 - frac)) >> 8);
+    addPixelAtBrightness(pixel + 1, c, ((uint16_t)life * frac) >> 8);
+  }
 }
 
 
@@ -117,166 +226,278 @@ void setupOrion() {
   // Each animation is responsible for calibrating its own speed relative to the globalSpeed.
   syspeed = 0;
 
-  animationStep = 0;
-  frameStep = 0;
+  resetAnimationClock();
   mode = 0;
   syspeed = 0;
   brightness = 1;
+  loadSettings();
+
+  seedRandom();
+  startMode();
 } // setupOrion()
 
 
-// All animations are controlled by a delay method. Range of delay is 0-5;
-// All animations must be totally non-blocking. That is, draw only one frame at a time.
-void updateOrion() {
-    
-  if(brightnessSemaphore)
-  {  
-    noInterrupts();
-    delay(500);
-    brightness++;
-     
-   if(brightness > NUMBER_BRIGHTNESS_LEVELS)
-     brightness = 1;
-     
-     brightnessSemaphore = false;
-    interrupts();
+// Reset everything the previous mode may have left running, then hand over to the new mode's init.
+void startMode()
+{
+  MODE_RESTART(&modeThread);
+  stopAudioSampling();
+  stopPov();
+  renderQuality = QUALITY_FULL;
+  memset(&modeArena, 0, sizeof(modeArena));
+  resetStackHeadroom();
+
+  ModeInit init = (ModeInit)pgm_read_word(&modeTable[mode].init);
+  if(init)
+    init(&modeArena);
+} // startMode()
+
+
+// Switch to mode m, as the mode button does.
+void changeMode(int m)
+{
+  // Keep the outgoing mode's last frame to blend the new mode in over.
+  beginTransition(strip);
+  mode = m;
+  resetAnimationClock();
+  startMode();
+} // changeMode()
+
+
+byte modeCount()
+{
+  return MODE_COUNT;
+} // modeCount()
+
+
+// Size of the mode arena: the most SRAM any one mode keeps between frames.
+uint16_t modeArenaSize()
+{
+  return sizeof(modeArena);
+} // modeArenaSize()
+
+
+byte modeFramePeriod(int m)
+{
+  return pgm_read_byte(&modeTable[m].framePeriod);
+} // modeFramePeriod()
+
+
+uint16_t modeStateSize(int m)
+{
+  return pgm_read_word(&modeTable[m].stateSize);
+} // modeStateSize()
+
+
+byte modePowerClass(int m)
+{
+  return pgm_read_byte(&modeTable[m].powerClass);
+} // modePowerClass()
+
+
+byte modeLowestQuality(int m)
+{
+  return pgm_read_byte(&modeTable[m].lowestQuality);
+} // modeLowestQuality()
+
+
+// Frame deadline scheduler. renderTime is how long the last frame took to draw and show, in microseconds.
+// Missing the budget drops one quality level straight away; getting back up takes a run of fast frames,
+// so a mode that only just fits does not flicker between levels.
+void adjustRenderQuality(unsigned long renderTime)
+{
+  static byte slackFrames = 0;
+
+  if(renderTime > animationStepPeriod())
+  {
+    slackFrames = 0;
+    if(renderQuality < modeLowestQuality(mode))
+      renderQuality++;
+    return;
   }
 
-  if(speedSemaphore)
-  {  
-    noInterrupts();
-    delay(200);
-    syspeed++;
-    
-     if(syspeed > NUMBER_SPEED_SETTINGS)
-       syspeed = 0;
-       
-     speedSemaphore = false;
-    interrupts();
+  if(renderQuality == QUALITY_FULL || renderTime > (animationStepPeriod() >> 1))
+  {
+    slackFrames = 0;
+    return;
   }
-  
-  if(modeSemaphore)
-  { 
-    noInterrupts();
-    delay(500);
-    mode++;
-     
-    if(mode > NUMBER_OF_MODES)
-      mode = 0;
-       
-    frameStep = 0;
-    animationStep = 0;
-    modeSemaphore = false;
-    interrupts();
-  }  
-  // Used to store a current color for modes which cycle through colors.
-  static uint32_t currentColor;
-
-  // This is used to calibrate the speed range for different modes
-  // Slow modes require a low frameDelayTimer (1-5). Fast modes require a high frameDelayTimer (5+).
-  static int frameDelayTimer = 5;
-  static long previousMillis = 0;
-  unsigned long currentMillis = millis();
-
-  // If insufficient time has elapsed since the last call just return and do nothing.
-  if(currentMillis - previousMillis < frameDelayTimer*syspeed)    
+
+  if(++slackFrames >= QUALITY_HOLD_FRAMES)
+  {
+    slackFrames = 0;
+    renderQuality--;
+  }
+} // adjustRenderQuality()
+
+
+// Pixel loop step for the current quality. Modes that support QUALITY_HALF draw
+// for(x = 0; x < PIXEL_COUNT; x += pixelStride()) and then call doublePixels().
+byte pixelStride()
+{
+  return renderQuality >= QUALITY_HALF ? 2 : 1;
+} // pixelStride()
+
+
+// Copy every even pixel over the odd one after it. Does nothing unless drawing at half resolution.
+void doublePixels()
+{
+  if(renderQuality < QUALITY_HALF)
     return;
-    
-  previousMillis = currentMillis;
 
-  switch(mode) {
-    case 0:
-      rainbow(); // Smooth rainbow animation.
-      frameDelayTimer = 1;
-      break;
-    case 1:
-      rainbowBreathing(10);
-      frameDelayTimer = 1;
-      break;
-    case 2:
-      plasma();
-      frameDelayTimer = 20;    
-      break;
-    case 3:
-      splitColorBuilder();
-      frameDelayTimer = 5;
-      break;
-    case 4:
-      smoothColors();
-      frameDelayTimer = 5;
-      break;
-    case 5:
-      // Single pixel random color pixel chase.
-      if(animationStep == 0)
-        currentColor =Wheel(random(0, 384));
-      colorChase(currentColor, syspeed);
-      frameDelayTimer = 5;    
-      break;
-    case 6:
-      // Random color wipe.
-      if(frameStep == 0)
-        currentColor = Wheel(random(0, 384));
-      colorWipe(currentColor, syspeed);
-      frameDelayTimer = 5;    
-      break;
-    case 7:
-      // Random color dither. This is a color to color dither (does not clear between colors).
-      {
-        long randNumber = random(0, 384);
-        uint32_t c = Wheel(((randNumber * 384 / strip.numPixels()) + randNumber) % 384);
-        dither(c, syspeed);
-      }  
-      frameDelayTimer = 8;    
-      break;
-    case 8:
-      if(animationStep == 0)
-        currentColor = Wheel(random(0, 384));
-      scanner(currentColor, syspeed);  
-      frameDelayTimer = 5;    
-      break;
-    case 9:
-      // Sin wave effect. New color every cycle.
-      if(animationStep == 0)
-        currentColor = Wheel(random(0, 384));
-      wave(currentColor, syspeed);  
-      frameDelayTimer = 5;    
-      break;
-    case 10:
-      // Random color noise animation.
-      randomSparkle(syspeed);
-      frameDelayTimer = 3;    
-      break;
-    case 11:
-      // Color fade-in fade-out effect
-      if(animationStep==0)
-        currentColor =Wheel(random(0, 384));
-      
-      if(animationStep<192)
-        fadeIn(currentColor, 10); 
-      else
-        fadeOut(currentColor, 10);
+  for(int x = 0; x + 1 < PIXEL_COUNT; x += 2)
+    strip.setPixelColor(x + 1, strip.getPixelColor(x));
+} // doublePixels()
+
+
+// All animations are controlled by a delay method. Range of delay is 0-5;
+// All animations must be totally non-blocking. That is, draw only one frame per call and never show() or delay().
+// The frame is pushed to the strip here once the mode returns.
+void updateOrion() {
+
+  updateControls();
+  if(renderFrame())
+    showFrame();
+} // updateOrion()
+
+
+// Act on any button events. Returns true if there were any.
+// Speed and brightness step on a press and keep stepping while held. Mode steps on a press only.
+boolean updateControls() {
+  ButtonEvent event;
+  boolean acted = false;
+
+  while(nextButtonEvent(&event))
+  {
+    if(event.kind == BUTTON_PRESS && !pressPending)
+    {
+      pressPending = true;
+      pressTime = event.time;
+    }
+
+    if(event.button == BUTTON_LEVEL)
+    {  
+      brightness++;
+     
+     if(brightness > NUMBER_BRIGHTNESS_LEVELS)
+       brightness = 1;
+    }
+
+    if(event.button == BUTTON_SPEED)
+    {  
+      syspeed++;
     
-      frameDelayTimer = 1;
-      break;
-    case 12:
-      sparkler();
-      frameDelayTimer = 10;
-      break;
-    default:
-      ; // This should never happen. 
-  } // switch()
-  
-  // Global animation frame limit of 384 (for full color wheel range).
-  // Large animationSteps slow down the driver.
-  animationStep++;
-  if(animationStep>384)
-    animationStep = 0;
+       if(syspeed > NUMBER_SPEED_SETTINGS)
+         syspeed = 0;
+    }
   
-  // Ensure that only as many pixels are drawn as there are in the strip.
-  frameStep++;
-  if(frameStep > PIXEL_COUNT)
-    frameStep = 0;
-} // updateOrion()
+    if(event.button == BUTTON_MODE && event.kind == BUTTON_PRESS)
+    { 
+      changeMode(mode + 1 < MODE_COUNT ? mode + 1 : 0);
+    }
+
+    acted = true;
+  }
+
+  return acted;
+} // updateControls()
+
+
+// Draw the next frame into the strip buffer if one is due. Returns true if a frame was drawn.
+boolean renderFrame() {
+
+  // Only draw once at least one step of animation is due. Under load each frame simply covers more steps,
+  // so the animation keeps its speed and drops frames instead of slowing down.
+  if(frameReady || streamActive() || streamReceiving() || !advanceAnimationClock())
+    return false;
+
+  unsigned long frameStart = timeMicros();
+
+  ModeFunction frame = (ModeFunction)pgm_read_word(&modeTable[mode].frame);
+  frame();
+
+  renderTime = timeMicros() - frameStart;
+  frameReady = true;
+
+  animationCycleStart = false;
+  frameCycleStart = false;
+  return true;
+} // renderFrame()
+
+
+// Take in host driven frames (see serialStream.h). A completed frame is shown by showFrame() like a drawn one.
+// Returns true if one was completed.
+// While the unit is off nothing sends frames, so a frame left waiting would stop the parser, and with it the
+// telemetry dump request, until the next power on. Off, frames are taken in and dropped.
+boolean receiveFrame(boolean poweredOn) {
+  if(!poweredOn)
+    frameReady = false;
+  if(frameReady)
+    return false;
+
+  boolean wasStreaming = streamActive();
+  if(!receiveStream(strip))
+  {
+    // The host has stopped. Carry on with the mode from where the clock says it is now.
+    if(wasStreaming && !streamActive())
+      resetAnimationClock();
+    return false;
+  }
+
+  renderTime = 0;
+  frameReady = poweredOn;
+  return true;
+} // receiveFrame()
+
+
+// Send the frame drawn by renderFrame() to the strip. During a mode transition the frame is resent
+// every TRANSITION_FRAME_US as well, so the blend moves smoothly even in slow modes.
+// Returns true if anything was sent.
+boolean showFrame() {
+
+  if(!frameReady && !transitionDue())
+    return false;
+
+  // The POV image has the SPI bus to itself while it plays (see pov.h).
+  if(povActive())
+  {
+    frameReady = false;
+    return false;
+  }
+
+  unsigned long showStart = timeMicros();
+
+  // A blend of two frames draws no more than the brighter of them.
+  uint16_t channelSum = strip.getChannelSum();
+  if(transitionChannelSum() > channelSum)
+    channelSum = transitionChannelSum();
+  limitStripPower(strip, channelSum);
+  accountFrameEnergy(channelSum);
+  countTelemetryFrame(strip.getScale());
+
+  showTransition(strip);
+
+  streamFrameShown();
+
+  if(pressPending)
+  {
+    recordPressLatency(pressTime);
+    pressPending = false;
+  }
+
+  if(frameReady)
+  {
+    frameReady = false;
+    adjustRenderQuality(renderTime + (timeMicros() - showStart));
+  }
+  return true;
+} // showFrame()
+
+
+// Steps a mode that simulates one step at a time runs this frame: stepsElapsed, up to MAX_CATCH_UP_STEPS.
+static int catchUpSteps()
+{
+  return stepsElapsed < MAX_CATCH_UP_STEPS ? stepsElapsed : MAX_CATCH_UP_STEPS;
+} // catchUpSteps()
 
 
 void solidColor()
@@ -284,57 +505,255 @@ void solidColor()
     for (int i=0; i < strip.numPixels(); i++) {
      strip.setPixelColor(i, strip.Color(127, 127, 127));
     }
-    strip.show();
-
 }
 
 void plasma() {
   
     double time = animationStep;
             
-    for(int y = 0; y < PIXEL_COUNT; y++)
+    for(int y = 0; y < PIXEL_COUNT; y += pixelStride())
     {
-        double value = sin(dist(frameStep + time, y, 64.0, 64.0) / 4.0)
-                   + sin(dist(frameStep, y, 32.0, 32.0) / 4.0);
-                   + sin(dist(frameStep, y + time / 7, 95.0, 32) / 3.5);
-                   + sin(dist(frameStep, y, 95.0, 50.0) / 4.0);
+        double value = sin(dist(frameStep + time, y, 64.0, 64.0) / 4.0);
+        // Below full quality only the moving term is kept; it is the one that carries the motion.
+        if(renderQuality == QUALITY_FULL)
+          value += sin(dist(frameStep, y, 32.0, 32.0) / 4.0);
   
       int color = int((4 + value)*384)%384;
       setPixelAtBrightness(y, Wheel(color));
       //strip.setPixelColor(y, Wheel(color)); 
     }    
-  strip.show();
+    doublePixels();
 }
 
 void sparkler() {
+  byte *heat = MODE_STATE(HeatState).heat;
   
-  stripBufferA[random(0,PIXEL_COUNT)] = random(0, 255);
+  for(int n = catchUpSteps(); n > 0; n--)
+  {
+    addSpark(heat, PIXEL_COUNT, random8(PIXEL_COUNT), random8());
+    blur2(heat, PIXEL_COUNT);
+    decay(heat, PIXEL_COUNT, 15);
+  }
 
   for(int x = 0; x < PIXEL_COUNT; x++) 
     {
-      byte newPoint = (stripBufferA[x] + stripBufferA[x+1]) / 2 - 15;
-      stripBufferB[x] = newPoint;
+      byte newPoint = heat[x];
       if(newPoint>50)
         setPixelAtBrightness(x, Wheel(((newPoint/5)+animationStep)%384));
-//         strip.setPixelColor(x, Wheel(((newPoint/5)+animationStep)%384));      
-      if(newPoint<50)
+      else
         setPixelAtBrightness(x, strip.Color(0, 0, 0));
-//         strip.setPixelColor(x, strip.Color(0,0,0)); 
     }
-   
-   strip.show();
-    
-    for(int x = 0; x < PIXEL_COUNT; x++) 
+}
+
+
+// Flames rising from the start of the strip.
+// Each step the heat cools a little, drifts up the strip and new sparks ignite near the base.
+void fire() {
+  byte *heat = MODE_STATE(HeatState).heat;
+
+  // Random cooling per pixel gives the flicker. Longer strips cool less so the flame reaches further.
+  byte cooling = (55 * 10) / PIXEL_COUNT + 2;
+  for(int n = catchUpSteps(); n > 0; n--)
+  {
+    for(int x = 0; x < PIXEL_COUNT; x++)
     {
-      stripBufferA[x] = stripBufferB[x];
-   }
-  
+      byte cool = random8(cooling);
+      heat[x] = heat[x] > cool ? heat[x] - cool : 0;
+    }
+
+    diffuseHeat(heat, PIXEL_COUNT);
+
+    if(random8() < 120)
+      addSpark(heat, PIXEL_COUNT, random8(7), random8(160, 255));
+  }
+
+  for(int x = 0; x < PIXEL_COUNT; x++)
+    setPixelAtBrightness(x, heatColor(heat[x]));
 }
 
 
-void rainbowBreathing(uint16_t wait)
+// Slow rolling blobs of molten rock. Most of the belt is dark crust with glowing seams.
+void lava() {
+  uint16_t &drift = MODE_STATE(DriftState).drift;
+  drift += 4 * stepsElapsed;
+
+  for(int x = 0; x < PIXEL_COUNT; x += pixelStride())
+  {
+    // Value noise is cheaper than gradient noise, at the cost of blockier blobs.
+    byte heat = renderQuality == QUALITY_FULL ? inoise8(x * 40, drift) : vnoise8(x * 40, drift);
+    // Drop the bottom quarter to black and stop short of white hot.
+    setPixelAtBrightness(x, heatColor(heat > 64 ? heat - 64 : 0));
+  }
+  doublePixels();
+}
+
+
+// Deep blue swell with ripples on top and white foam on the crests.
+void ocean() {
+  uint16_t &drift = MODE_STATE(DriftState).drift;
+  drift += 3 * stepsElapsed;
+
+  for(int x = 0; x < PIXEL_COUNT; x += pixelStride())
+  {
+    byte swell = inoise8(x * 24, drift);
+    byte level = swell;
+    // The ripple octave is the first thing to go when frames run late.
+    if(renderQuality == QUALITY_FULL)
+    {
+      byte chop = inoise8(x * 96 + drift, drift * 2);
+      level = ((uint16_t)swell * 3 + chop) >> 2;
+    }
+
+    byte foam = level > 200 ? (level - 200) * 2 : 0;
+    byte g    = level >> 2;
+    byte b    = 32 + (((uint16_t)level * 95) >> 8);
+    setPixelAtBrightness(x, strip.Color(foam, g > foam ? g : foam, b));
+  }
+  doublePixels();
+}
+
+
+// Bursts of sparks that fly apart and burn out. Random colors.
+void fireworks() {
+
+  // A new shell roughly every 40 steps, so two or three bursts overlap.
+  for(int n = catchUpSteps(); n > 0; n--)
+  {
+    if(random8() < 6)
+      emitBurst(random16(PIXEL_COUNT << 8), 12, 48, random8(), 255);
+
+    updateParticles(6, 0);
+  }
+
+  for(int x = 0; x < PIXEL_COUNT; x++)
+    strip.setPixelColor(x, 0);
+  drawParticles();
+}
+
+
+// Meteors streak down the strip shedding a tail of slow embers.
+void meteorShower() {
+
+  // The meteor head is tracked here rather than in the pool, so it never burns out before reaching the end.
+  uint16_t &meteorPos = MODE_STATE(MeteorState).pos;
+  byte     &meteorHue = MODE_STATE(MeteorState).hue;
+
+  for(int n = catchUpSteps(); n > 0; n--)
+  {
+    if(meteorPos == 0 && random8() < 8)
+    {
+      meteorPos = (PIXEL_COUNT << 8) - 1;
+      meteorHue = random8();
+    }
+
+    if(meteorPos != 0)
+    {
+      emitSpray(meteorPos, -4, 6, meteorHue, 160, 200);
+      meteorPos = meteorPos > 0x180 ? meteorPos - 0x180 : 0;
+    }
+
+    updateParticles(5, 0);
+  }
+
+  for(int x = 0; x < PIXEL_COUNT; x++)
+    strip.setPixelColor(x, 0);
+  if(meteorPos != 0)
+    addPixelAtBrightness(meteorPos >> 8, strip.Color(127, 127, 127), 255);
+  drawParticles();
+}
+
+
+// Init for the audio modes. They keep nothing in their state that needs setting up, only the microphone.
+void startAudioMode(void *state)
+{
+  startAudioSampling();
+}
+
+
+// Rainbow that surges forward with the music and flashes on every beat.
+// Needs the microphone on PIN_MIC_SENSE.
+void audioRainbow() {
+
+  int &surge = MODE_STATE(SurgeState).surge;
+
+  updateAudio();
+
+  // Loud passages move the rainbow faster; each beat kicks it an eighth of the way round.
+  surge += audioLevel >> 5;
+  if(audioBeat)
+  {
+    surge += 48;
+    audioBeat = false;
+  }
+  surge %= 384;
+
+  // Never fully dark, so the belt still reads as a rainbow between beats.
+  byte level = 64 + ((uint16_t)audioLevel * 3 >> 3) + (audioBeatPulse >> 2);
+
+  for(int x = 0; x < PIXEL_COUNT; x++)
+  {
+    strip.setPixelColor(x, 0);
+    addPixelAtBrightness(x, Wheel(((x * 384 / PIXEL_COUNT) + animationStep + surge) % 384), level);
+  }
+}
+
+
+// The strip is split into one segment per band, bass first. Each segment glows with its band's energy.
+// Hue drifts on every beat. Needs the microphone on PIN_MIC_SENSE.
+void audioSpectrum() {
+  uint16_t &hue = MODE_STATE(SpectrumState).hue;
+
+  updateAudio();
+
+  if(audioBeat)
+  {
+    hue = (hue + 64) % 384;
+    audioBeat = false;
+  }
+
+  for(int x = 0; x < PIXEL_COUNT; x++)
+  {
+    byte band = (x * AUDIO_BANDS) / PIXEL_COUNT;
+    strip.setPixelColor(x, 0);
+    addPixelAtBrightness(x, Wheel((hue + band * (384 / AUDIO_BANDS)) % 384), audioBands[band]);
+  }
+}
+
+
+// Plays the animation in animationData.h, made with tools/animation_encode.py. One animation frame per step,
+// so dropped steps are decoded too: the deltas need every frame. The frames are decoded into the mode's own
+// state, which nothing else writes, and copied to the strip at the brightness setting.
+void startPlayback(void *state)
+{
+  startAnimation(&((PlaybackState *)state)->player, __animation);
+}
+
+
+void playback() {
+  PlaybackState &playbackState = MODE_STATE(PlaybackState);
+
+  // Catch up at most a few frames, so a long stall does not turn into a long decode.
+  for(int n = catchUpSteps(); n > 0; n--)
+    if(!decodeAnimationFrame(&playbackState.player, playbackState.pixels, sizeof(playbackState.pixels)))
+      return;
+
+  const byte *p = playbackState.pixels;
+  for(int x = 0; x < PIXEL_COUNT; x++, p += 3)
+    setPixelAtBrightness(x, ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2]);
+}
+
+
+// Light painting: the image in povData.h, made with tools/pov_convert.py, one column at a time from Timer3.
+// The mode draws nothing itself. It only starts the image once the strip is on, and again after a power cycle.
+void pov() {
+  if(!povActive())
+    startPov(__povImage, strip);
+}
+
+
+void rainbowBreathing(void)
 {
-  static int shifter = 0;
+  int shifter = MODE_STATE(BreathingState).shifter;
   uint16_t i, j;
   if(animationStep<192)
   {
@@ -356,7 +775,6 @@ void rainbowBreathing(uint16_t wait)
       //strip.setPixelColor(i, r*modifier, g*modifier, b*modifier);
 //      strip.setPixelColor(i, gamma(r*modifier), gamma(g*modifier), gamma(b*modifier));
     }
-  strip.show();   // write all the pixels out
   } else {
   float modifier = 1.75-0.004*(float)animationStep;
 
@@ -377,7 +795,6 @@ void rainbowBreathing(uint16_t wait)
      // strip.setPixelColor(i, r*modifier, g*modifier, b*modifier);
 //      strip.setPixelColor(i, gamma(r*modifier), gamma(g*modifier), gamma(b*modifier));
     }
-  strip.show();   // write all the pixels out   
   }
 } 
   
@@ -390,7 +807,6 @@ void rainbow() {
       {
         setPixelAtBrightness(i, Wheel(((i * 384 / pixelCount) + animationStep) % 384));
       }
-      strip.show();   // write all the pixels out
 }
 
 void splitColorBuilder() {
@@ -415,8 +831,6 @@ void splitColorBuilder() {
     setPixelAtBrightness(PIXEL_COUNT/2+i, strip.Color(r2,g2,b2)); 
   }
   
-  strip.show();   // write all the pixels out
-
 }
 
 void smoothColors() {
@@ -430,7 +844,20 @@ void smoothColors() {
         setPixelAtBrightness(i, c);
         
       }
-      strip.show();   // write all the pixels out
+}
+
+// Color fade-in fade-out effect. New random color for each fade.
+void fadeInOut()
+{
+  uint32_t &color = MODE_STATE(ColorState).color;
+
+  if(animationCycleStart)
+    color = Wheel(random16(384));
+
+  if(animationStep < 192)
+    fadeIn(color, 10);
+  else
+    fadeOut(color, 10);
 }
 
 void fadeOut(uint32_t c, uint16_t wait)
@@ -491,8 +918,6 @@ void fadeOut(uint32_t c, uint16_t wait)
       //strip.setPixelColor(i, r2, g2, b2);
       setPixelAtBrightness(i, strip.Color(r2, g2, b2));  
     }
-    
-    strip.show();   // write all the pixels out
 }
 
 void fadeIn(uint32_t c, uint16_t wait)
@@ -549,13 +974,12 @@ void fadeIn(uint32_t c, uint16_t wait)
       setPixelAtBrightness(i, strip.Color(r2, g2, b2));
 //      strip.setPixelColor(i, r2, g2, b2);
     }
-    
-    strip.show();   // write all the pixels out
 }
 
 
-void pulseStrobe(uint32_t c, uint16_t wait)
+void pulseStrobe(void)
 {
+    uint32_t c = MODE_STATE(ColorState).color;
     for (int i=0; i < strip.numPixels(); i++) 
     {
       if(animationStep%2)
@@ -567,264 +991,227 @@ void pulseStrobe(uint32_t c, uint16_t wait)
 //        strip.setPixelColor(i, dampenBrightness(c, 10)); 
         }
     
-    strip.show();   // write all the pixels out  
     }
 }
 
 
 // Cycle through the color wheel, equally spaced around the belt
-void rainbowCycle(uint16_t wait) {
+void rainbowCycle(void) {
   uint16_t i, j;
   for (i=0; i < strip.numPixels(); i++) 
   {
     setPixelAtBrightness(i, Wheel(((i * 384 / strip.numPixels()) + animationStep) % 384));
 //    strip.setPixelColor(i, Wheel(((i * 384 / strip.numPixels()) + animationStep) % 384));
   }
-  strip.show();   // write all the pixels out
-  delay(wait);
-  animationStep++;
 }
 
 // fill the dots one after the other with said color
 // good for testing purposes
-void colorWipe(uint32_t c, uint16_t wait) {
+void colorWipe(void) {
   int i;
+
+  // New random color for each wipe.
+  if(frameCycleStart)
+    MODE_STATE(ColorState).color = Wheel(random16(384));
+  uint32_t c = MODE_STATE(ColorState).color;
  
   for (i=0; i < frameStep; i++) 
     {
     setPixelAtBrightness(i, c);
     }
-   
-    strip.show(); 
 }
 
 
 // Chase a dot down the strip
 // Random color for each chase
-void colorChase(uint32_t c, uint16_t wait) {
+void colorChase(void) {
   int i;
 
-    setPixelAtBrightness(frameStep-1, 0); // Erase pixel, but don't refresh!
-    setPixelAtBrightness(frameStep, c); // Set new pixel 'on'
-    strip.show(); // Refresh LED states
+  if(animationCycleStart)
+    MODE_STATE(ColorState).color = Wheel(random16(384));
+  uint32_t c = MODE_STATE(ColorState).color;
+
+  // Clear the whole strip rather than just the previous pixel, which is not frameStep-1 when frames are dropped.
+  for (i=0; i < PIXEL_COUNT; i++)
+    strip.setPixelColor(i, 0);
+  setPixelAtBrightness(frameStep, c);
 }
 
 
 // An "ordered dither" fills every pixel in a sequence that looks
 // sparkly and almost random, but actually follows a specific order.
-void dither(uint32_t c, uint16_t wait) {
- 
-  // Determine highest bit needed to represent pixel index
-  int hiBit = 0;
-  int n = strip.numPixels() - 1;
-  for(int bit=1; bit < 0x8000; bit <<= 1) {
-    if(n & bit) hiBit = bit;
+// One pixel per animation step. Each pass dithers to a new random color over the last (does not clear between colors).
+void dither(void) {
+  DitherState &ditherState = MODE_STATE(DitherState);
+
+  MODE_BEGIN(&modeThread);
+
+  {
+    long randNumber = random16(384);
+    ditherState.color = Wheel(((randNumber * 384 / strip.numPixels()) + randNumber) % 384);
   }
 
-  int bit, reverse;
-  for(int i=0; i<(hiBit << 1); i++) {
-    // Reverse the bits in i to create ordered dither:
-    reverse = 0;
-    for(bit=1; bit <= hiBit; bit <<= 1) {
-      reverse <<= 1;
-      if(i & bit) reverse |= 1;
+  // Determine highest bit needed to represent pixel index
+  ditherState.hiBit = 0;
+  {
+    int n = strip.numPixels() - 1;
+    for(int bit=1; bit < 0x8000; bit <<= 1) {
+      if(n & bit) ditherState.hiBit = bit;
     }
-    setPixelAtBrightness(reverse, c);
-    //strip.setPixelColor(reverse, c);
-    strip.show();
-    delay(wait);
   }
-  delay(wait);  
-}
-
 
-void randomSparkle(uint16_t wait) {
+  for(ditherState.i=0; ditherState.i<(ditherState.hiBit << 1); ) {
+    {
+      // Catch up on any steps missed by dropped frames.
+      for(int n = stepsElapsed; n > 0 && ditherState.i < (ditherState.hiBit << 1); n--) {
+        // Reverse the bits in i to create ordered dither:
+        int bit, reverse = 0;
+        for(bit=1; bit <= ditherState.hiBit; bit <<= 1) {
+          reverse <<= 1;
+          if(ditherState.i & bit) reverse |= 1;
+        }
+        setPixelAtBrightness(reverse, ditherState.color);
+        ditherState.i++;
+      }
+    }
+    YIELD_FRAME();
+  }
 
-  long randNumber;
-  
-  // Determine highest bit needed to represent pixel index
-  uint16_t i, j;
+  // Resuming here draws nothing, which holds the finished pattern for one frame before the next color starts.
+  MODE_END();
+}
 
-  randNumber = random(0, strip.numPixels()-1);
-  setPixelAtBrightness(randNumber, Wheel(random(0,384)));
-  //strip.setPixelColor(randNumber, Wheel(((frameStep * 384 / strip.numPixels()) + animationStep) % 384));
-  strip.show();
 
+// One new sparkle per step.
+void randomSparkle(void) {
 
+  for(int n = catchUpSteps(); n > 0; n--)
+    setPixelAtBrightness(random8(strip.numPixels()), Wheel(random16(384)));
 }
 
+// White band sweeping back and forth over red.
 void canada2() {
+  ScannerState &scannerState = MODE_STATE(ScannerState);
 
-  int i, j, pos, dir;
+  MODE_BEGIN(&modeThread);
 
-  if(frameStep == 0)
+  for(scannerState.step = 0; ; scannerState.step += stepsElapsed)
   {
-    pos = 0;
-    dir = 2;
-  }
-  
-  pos = frameStep*2;
-  
-   if(pos >= strip.numPixels()) 
-   {
-     pos = 32-((frameStep-16)*2);
+    scannerState.step %= 2 * (PIXEL_COUNT - 1);
+
+    {
+      int pos = scannerPosition(scannerState.step);
+      for(int j=-2; j<= 2; j++) 
+        strip.setPixelColor(pos+j, strip.Color(127,127,127));
     }
-  
- // pos = frameStep;
-    // Draw 5 pixels centered on pos.  setPixelColor() will clip
-    // any pixels off the ends of the strip, no worries there.
-    // we'll make the colors dimmer at the edges for a nice pulse
-    // look
-    strip.setPixelColor(pos - 2, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos - 1, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos + 1, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos + 2, strip.Color(127, 127, 127));
-   
-   
-
-    strip.show();
-    // If we wanted to be sneaky we could erase just the tail end
-    // pixel, but it's much easier just to erase the whole thing
-    // and draw a new one next time.
-    for(j=-2; j<= 2; j++) 
-        strip.setPixelColor(pos+j, strip.Color(127,0,0));
-        
-    strip.setPixelColor(pos - 1, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos - 0, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos+1, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos + 2, strip.Color(127, 127, 127));
-    strip.setPixelColor(pos + 3, strip.Color(127, 127, 127));
 
-    strip.show();
-    // If we wanted to be sneaky we could erase just the tail end
-    // pixel, but it's much easier just to erase the whole thing
-    // and draw a new one next time.
-    for(j=-1; j<= 3; j++) 
+    YIELD_FRAME();
+
+    {
+      int pos = scannerPosition(scannerState.step);
+      for(int j=-2; j<= 2; j++) 
         strip.setPixelColor(pos+j, strip.Color(127,0,0));
+    }
+  }
+
+  MODE_END();
 }
+
+// Red band sweeping back and forth over white.
 void canada() {
+  ScannerState &scannerState = MODE_STATE(ScannerState);
 
-  int i, j, pos, dir;
+  MODE_BEGIN(&modeThread);
 
-  if(frameStep == 0)
+  for(scannerState.step = 0; ; scannerState.step += stepsElapsed)
   {
-    pos = 0;
-    dir = 2;
-  }
-  
-  pos = frameStep*2;
-  
-   if(pos >= strip.numPixels()) 
-   {
-     pos = 32-((frameStep-16)*2);
+    scannerState.step %= 2 * (PIXEL_COUNT - 1);
+
+    {
+      int pos = scannerPosition(scannerState.step);
+      for(int j=-4; j<= 4; j++) 
+        strip.setPixelColor(pos+j, strip.Color(127,0,0));
     }
-  
- // pos = frameStep;
-    // Draw 5 pixels centered on pos.  setPixelColor() will clip
-    // any pixels off the ends of the strip, no worries there.
-    // we'll make the colors dimmer at the edges for a nice pulse
-    // look
-    strip.setPixelColor(pos - 4, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 3, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 2, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 1, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos + 1, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos + 2, strip.Color(127, 0, 0));
-     strip.setPixelColor(pos + 3, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos + 4, strip.Color(127, 0, 0));
-   
-   
-
-    strip.show();
-    // If we wanted to be sneaky we could erase just the tail end
-    // pixel, but it's much easier just to erase the whole thing
-    // and draw a new one next time.
-    for(j=-4; j<= 4; j++) 
-        strip.setPixelColor(pos+j, strip.Color(127,127,127));
-        
-            strip.setPixelColor(pos - 3, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 2, strip.Color(127, 0, 0));
-
-    strip.setPixelColor(pos - 1, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 0, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos+1, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos + 2, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos + 3, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 4, strip.Color(127, 0, 0));
-    strip.setPixelColor(pos - 5, strip.Color(127, 0, 0));
-
-    strip.show();
-    // If we wanted to be sneaky we could erase just the tail end
-    // pixel, but it's much easier just to erase the whole thing
-    // and draw a new one next time.
-    for(j=-3; j<= 5; j++) 
+
+    YIELD_FRAME();
+
+    {
+      int pos = scannerPosition(scannerState.step);
+      for(int j=-4; j<= 4; j++) 
         strip.setPixelColor(pos+j, strip.Color(127,127,127));
+    }
+  }
+
+  MODE_END();
 }
 
 // "Larson scanner" = Cylon/KITT bouncing light effect
-// Draws two sets of frames per call to double the resolution range
-void scanner(uint32_t c, uint16_t wait) {
+// Draws a 5 pixel band that bounces from end to end, one pixel per animation step.
+// New random color for each cycle of animationStep.
+void scanner(void) {
 
-  byte  r, g, b;
-  
-  // Decompose color into its r, g, b elements
-  g = (c >> 16) & 0x7f;
-  r = (c >>  8) & 0x7f;
-  b =  c        & 0x7f; 
-  
-  int i, j, pos, dir;
+  ScannerState &scannerState = MODE_STATE(ScannerState);
+
+  if(animationCycleStart)
+    scannerState.color = Wheel(random16(384));
+  uint32_t c = scannerState.color;
 
-  if(frameStep == 0)
+  MODE_BEGIN(&modeThread);
+
+  for(scannerState.step = 0; ; scannerState.step += stepsElapsed)
   {
-    pos = 0;
-    dir = 2;
-  }
-  
-  pos = frameStep*2;
-  
-   if(pos >= strip.numPixels()) 
-   {
-     pos = 32-((frameStep-16)*2);
+    scannerState.step %= 2 * (PIXEL_COUNT - 1);
+
+    {
+      byte  r, g, b;
+      int pos = scannerPosition(scannerState.step);
+
+      // Decompose color into its r, g, b elements
+      g = (c >> 16) & 0x7f;
+      r = (c >>  8) & 0x7f;
+      b =  c        & 0x7f; 
+
+      // Draw 5 pixels centered on pos.  setPixelColor() will clip
+      // any pixels off the ends of the strip, no worries there.
+      // we'll make the colors dimmer at the edges for a nice pulse
+      // look
+      setPixelAtBrightness(pos - 2, strip.Color(r/4, g/4, b/4));
+      setPixelAtBrightness(pos - 1, strip.Color(r/2, g/2, b/2));
+      setPixelAtBrightness(pos, strip.Color(r, g, b));
+      setPixelAtBrightness(pos + 1, strip.Color(r/2, g/2, b/2));
+      setPixelAtBrightness(pos + 2, strip.Color(r/4, g/4, b/4));
     }
-  
- // pos = frameStep;
-    // Draw 5 pixels centered on pos.  setPixelColor() will clip
-    // any pixels off the ends of the strip, no worries there.
-    // we'll make the colors dimmer at the edges for a nice pulse
-    // look
-    
-    setPixelAtBrightness(pos - 2, strip.Color(r/4, g/4, b/4));
-    setPixelAtBrightness(pos - 1, strip.Color(r/2, g/2, b/2));
-    setPixelAtBrightness(pos, strip.Color(r, g, b));
-    setPixelAtBrightness(pos + 1, strip.Color(r/2, g/2, b/2));
-    setPixelAtBrightness(pos + 2, strip.Color(r/4, g/4, b/4));
 
-    strip.show();
-    // If we wanted to be sneaky we could erase just the tail end
-    // pixel, but it's much easier just to erase the whole thing
-    // and draw a new one next time.
-    for(j=-2; j<= 2; j++) 
-        strip.setPixelColor(pos+j, strip.Color(0,0,0));
-        
-    setPixelAtBrightness(pos - 1, strip.Color(r/4, g/4, b/4));
-    setPixelAtBrightness(pos - 0, strip.Color(r/2, g/2, b/2));
-    setPixelAtBrightness(pos+1, strip.Color(r, g, b));
-    setPixelAtBrightness(pos + 2, strip.Color(r/2, g/2, b/2));
-    setPixelAtBrightness(pos + 3, strip.Color(r/4, g/4, b/4));
+    YIELD_FRAME();
 
-    strip.show();
     // If we wanted to be sneaky we could erase just the tail end
     // pixel, but it's much easier just to erase the whole thing
     // and draw a new one next time.
-    for(j=-1; j<= 3; j++) 
+    {
+      int pos = scannerPosition(scannerState.step);
+      for(int j=-2; j<= 2; j++) 
         strip.setPixelColor(pos+j, strip.Color(0,0,0));
+    }
+  }
+
+  MODE_END();
+}
+
+
+// Position of a band bouncing between the two ends of the strip, for step 0 to 2*(PIXEL_COUNT-1).
+int scannerPosition(int step)
+{
+  return step < PIXEL_COUNT ? step : 2 * (PIXEL_COUNT - 1) - step;
 }
 
+
 // Sine wave effect.
-// Self calibrating for pixel run length.
-void wave(uint32_t c, uint16_t wait) {
+// Self calibrating for pixel run length. New random color every cycle.
+void wave(void) {
+  if(animationCycleStart)
+    MODE_STATE(ColorState).color = Wheel(random16(384));
+  uint32_t c = MODE_STATE(ColorState).color;
+
   float y;
   byte  r, g, b, r2, g2, b2;
 
@@ -852,7 +1239,6 @@ void wave(uint32_t c, uint16_t wait) {
       setPixelAtBrightness(i, strip.Color(r2, g2, b2));
 //      strip.setPixelColor(i, r2, g2, b2);
     }
-    strip.show();
 }
 
 
@@ -884,6 +1270,23 @@ uint32_t Wheel(uint16_t WheelPos)
 }
 
 
+//Input a heat value 0 to 255 to get a flame color.
+//Black - red - yellow - white as the heat rises.
+
+uint32_t heatColor(byte temperature)
+{
+  // Scale to 0-191 so the heat splits into three equal bands of 64.
+  byte t192 = ((uint16_t)temperature * 191) >> 8;
+  byte ramp = (t192 & 0x3F) << 1; // 0-126 within the band
+
+  if(t192 & 0x80)
+    return(strip.Color(127, 127, ramp));  // hottest
+  if(t192 & 0x40)
+    return(strip.Color(127, ramp, 0));    // middle
+  return(strip.Color(ramp, 0, 0));        // coolest
+}
+
+
 uint32_t dampenBrightness(uint32_t c, int brightness) {
 
  byte  r, g, b;
@@ -893,7 +1296,6 @@ uint32_t dampenBrightness(uint32_t c, int brightness) {
   b = (c        & 0x7f)/brightness; 
 
   return(strip.Color(r,g,b));
-
 }
 
 
@@ -39,19 +39,39 @@
  strip.Color(r, g, b)         Returns a uint32_t variable for the specified r,g,b combination
  strip.setPixelColor(i, c)    Sets the pixel at position i to the color c (a uint32_t). 
  strip.show()                 Refreshes the pixels. All LEDs are updated. To maximize performance, limit this call.
- delay(x)                     Delay the program for x number of milliseconds. Used to calibrate speed of modes.
- globalSpeed                  This is a universal speed used in the delay(x) calls within the animations.
- animationStep                A variable constrained to the range 0-384. Use this to animate your modes. Each mode must control its use of animationStep
- frameStep                    Tracks the frame position 0-PIXEL_COUNT. Uses to retain frame position between frame draws.
+ syspeed                      The speed setting. It sets the step period, see Animation timing below. Modes never delay().
+ animationStep                A variable constrained to the range 0-384. Use this to animate your modes. It advances with time, not with frames drawn.
+ frameStep                    Tracks the frame position 0-PIXEL_COUNT. Uses to retain frame position between frame draws. Counts the same steps as animationStep.
+ stepsElapsed                 Whole animationSteps since the last frame, never 0. Usually 1; more when frames are dropped. Scale per-frame motion by it.
+ animationCycleStart          True on the first frame of each animationStep cycle. Test this rather than animationStep == 0, which may be skipped.
+ frameCycleStart              The same for frameStep.
+ renderQuality                Level of detail to draw at, QUALITY_FULL down to the mode's lowestQuality. Set by the frame scheduler.
+ pixelStride()                Step for the pixel loop: 2 at QUALITY_HALF. Call doublePixels() after drawing to fill the gaps.
+
+ Animation timing:
+ animationStep is read from a 16.16 fixed point phase accumulator that advances by elapsed microseconds times a rate
+ (animationClock.h).
+ frameStep moves on by the same steps, round PIXEL_COUNT+1 instead of 385.
+ A frame is drawn only when at least one step is due, so a slow frame makes the next one cover more steps and the perceived speed holds.
+ A mode that moves on once per call instead (a simulation, a decoder) runs stepsElapsed steps of it.
+ One step lasts framePeriod * syspeed milliseconds (framePeriod from modeList.h), i.e. 1000 / (framePeriod * syspeed) Hz.
+ Speed 0 is framePeriod / 2 milliseconds. No step is shorter than 2 ms.
+
+ Level of detail:
+ The time spent drawing and showing each frame is measured against the step period. When a frame overruns it,
+ renderQuality drops one level, as far as the mode's lowestQuality. After QUALITY_HOLD_FRAMES frames in a row that
+ take less than half the budget it goes back up one level. A mode change always starts at QUALITY_FULL.
 */
 #include <Arduino.h>
+#include "animationClock.h"
 
 // Current draw per meter (32 pixels) at 100%, 50%, 25% brightness
 // Rainbow Mode 200mA / 90mA / 45 mA
 // Full White 500mA / 250mA / 125mA
+// powerLimiter.h models these from the pixel values and caps the strip at POWER_BUDGET_MA.
 
 // User defined option
-#define NUMBER_OF_MODES          12
+// The modes compiled in, and their order, are set by ORION_MODE_LIST in modeList.h.
 #define NUMBER_SPEED_SETTINGS    10
 #define NUMBER_BRIGHTNESS_LEVELS  5
 
@@ -68,12 +88,55 @@
 #define PI 3.14159265
 #define dist(a, b, c, d) sqrt(double((a - c) * (a - c) + (b - d) * (b - d)))
 
+// Expected current draw of a mode, used by the power and battery logic.
+enum {
+  POWER_LOW,
+  POWER_MEDIUM,
+  POWER_HIGH
+};
+
+// Render quality levels, best first. What a mode leaves out at each level is up to the mode.
+enum {
+  QUALITY_FULL,    // Everything
+  QUALITY_REDUCED, // Cheaper per pixel: fewer noise octaves or terms
+  QUALITY_HALF     // As QUALITY_REDUCED, and only every other pixel is drawn, then doubled
+};
+
+typedef void (*ModeFunction)(void);
+typedef void (*ModeInit)(void *state);
+
+// One entry of the mode table. The table lives in PROGMEM; read it with pgm_read_*().
+struct ModeDescriptor {
+  ModeFunction frame;       // Draws one frame per call
+  ModeInit     init;        // Called with the mode's zeroed state when the mode is selected, or NULL
+  byte         framePeriod; // Nominal milliseconds per frame at speed setting 1
+  uint16_t     stateSize;   // Bytes of state kept between frames
+  byte         powerClass;  // POWER_LOW, POWER_MEDIUM or POWER_HIGH
+  byte         lowestQuality; // Lowest QUALITY_ level the mode implements
+};
+
+extern const ModeDescriptor modeTable[];
+
 void setupOrion(void);
-void updateOrion(void);
+void updateOrion(void);    // updateControls(), then renderFrame() and showFrame() in one go
+boolean updateControls(void);
+boolean renderFrame(void);
+boolean receiveFrame(boolean poweredOn);
+boolean showFrame(void);
+void startMode(void);
+void changeMode(int m);
+byte modeFramePeriod(int m);
+uint16_t modeStateSize(int m);
+byte modeCount(void);
+uint16_t modeArenaSize(void);
+byte modePowerClass(int m);
+byte modeLowestQuality(int m);
+void adjustRenderQuality(unsigned long renderTime);
+byte pixelStride(void);
+void doublePixels(void);
 
-void stepMode(void);
-void stepSpeed(void);
 void stepBrightness(void);
+void powerUpStrip(void);
 void enable(boolean setBegun);
 void disable(void);
 boolean isEnabled(void);
@@ -86,25 +149,39 @@ void rainbow(void);
 void plasma(void);
 void splitColorBuilder(void);
 void smoothColors(void);
+void fadeInOut(void);                             // Fades a random color in and out. Medium drain mode.
 void fadeIn(uint32_t c, uint16_t wait);
 void fadeOut(uint32_t c, uint16_t wait);
 void sparkler(void);
-void rainbowCycle(uint16_t wait);                 // Standard rainbow mode. Medium drain mode.
+void rainbowCycle(void);                          // Standard rainbow mode. Medium drain mode.
 void rainbowStrobe(uint16_t wait);                // Steps through the rainbow, pulsing all the way. Medium drain mode.
-void rainbowBreathing(uint16_t wait);             // Slow pulsating rainbow. Medium drain mode.
-void pulseStrobe(uint32_t c, uint16_t wait);      // Fast flashy strobe. Medium drain mode.
+void rainbowBreathing(void);                      // Slow pulsating rainbow. Medium drain mode.
+void pulseStrobe(void);                           // Fast flashy strobe. Medium drain mode.
 void smoothStrobe(uint32_t c, uint16_t wait);     // Pulses a color on and off. Medium drain mode.
-void colorChase(uint32_t c, uint16_t wait);       // Single pixel random color chase. Low drain mode.
-void colorWipe(uint32_t c, uint16_t wait);        // Random color fill. Medium drain mode.
-void dither(uint32_t c, uint16_t wait);           // Random multi-color dither. Medium drain mode.
-void scanner(uint32_t c, uint16_t wait);          // Bounced a 5 pixel wide color band across the strip.
-void wave(uint32_t c, uint16_t wait);             // Sine wave color ranges from full white to c. Random colors. High drain mode.
-void randomSparkle(uint16_t wait);                // Sparkles with random colors at random points. Medium drain mode.
+void colorChase(void);                            // Single pixel random color chase. Low drain mode.
+void colorWipe(void);                             // Random color fill. Medium drain mode.
+void dither(void);                                // Random multi-color dither. Medium drain mode.
+void scanner(void);                               // Bounced a 5 pixel wide color band across the strip.
+void wave(void);                                  // Sine wave color ranges from full white to c. Random colors. High drain mode.
+void randomSparkle(void);                         // Sparkles with random colors at random points. Medium drain mode.
+void fire(void);                                  // Flames rising from the start of the strip. High drain mode.
+void lava(void);                                  // Slow rolling noise blobs in fire colors. Medium drain mode.
+void ocean(void);                                 // Blue noise swell with white foam on the crests. Medium drain mode.
+void fireworks(void);                             // Random colored bursts of sparks. Low drain mode.
+void meteorShower(void);                          // Meteors streak down the strip leaving ember trails. Low drain mode.
+void audioRainbow(void);                          // Rainbow that surges with the music and flashes on the beat. Needs a microphone.
+void audioSpectrum(void);                         // One segment per frequency band, glowing with its energy. Needs a microphone.
+void playback(void);                              // Plays a compressed animation from flash, see animation.h.
+void pov(void);                                   // Streams an image from flash a column at a time, see pov.h.
 void canada();
 void canada2();
 
 // Internal utility functions.
 uint32_t Wheel(uint16_t WheelPos);
+uint32_t heatColor(byte temperature);
+int scannerPosition(int step);
+void startAudioMode(void *state);
+void startPlayback(void *state);
 uint32_t dampenBrightness(uint32_t c, int brightness);
 
 #endif
@@ -0,0 +1,93 @@
+#include "particles.h"
+#include "orion.h"
+#include "noise.h"
+
+ParticlePool *particles;
+
+// Positions at or past this are off the end of the strip. Negative positions wrap round to above it.
+#define PARTICLE_POS_LIMIT ((uint16_t)PIXEL_COUNT << 8)
+
+
+void resetParticles(void *storage) {
+  particles = (ParticlePool *)storage;
+  particles->count = 0;
+} // resetParticles()
+
+
+boolean emitParticle(uint16_t pos, int8_t vel, uint8_t hue, uint8_t life) {
+  if(particles->count >= PARTICLE_POOL_SIZE || pos >= PARTICLE_POS_LIMIT || life == 0)
+    return false;
+
+  uint8_t i = particles->count++;
+  particles->pos[i]  = pos;
+  particles->vel[i]  = vel;
+  particles->hue[i]  = hue;
+  particles->life[i] = life;
+  return true;
+} // emitParticle()
+
+
+// Drop particle i by moving the last live particle into its slot.
+static void killParticle(uint8_t i) {
+  uint8_t last = --particles->count;
+  particles->pos[i]  = particles->pos[last];
+  particles->vel[i]  = particles->vel[last];
+  particles->hue[i]  = particles->hue[last];
+  particles->life[i] = particles->life[last];
+} // killParticle()
+
+
+// Advance every live particle one frame. Life drops by fade and velocity changes by gravity (4.4 fixed point).
+// Particles that burn out or leave the strip are removed.
+void updateParticles(uint8_t fade, int8_t gravity) {
+  uint8_t i = 0;
+
+  while(i < particles->count) {
+    uint8_t life = particles->life[i];
+    if(life <= fade) {
+      killParticle(i);
+      continue; // Slot i now holds a particle that has not been updated yet.
+    }
+    particles->life[i] = life - fade;
+
+    int16_t vel = particles->vel[i] + gravity;
+    particles->vel[i] = constrain(vel, -128, 127);
+
+    uint16_t pos = particles->pos[i] + ((int16_t)particles->vel[i] << 4);
+    if(pos >= PARTICLE_POS_LIMIT) {
+      killParticle(i);
+      continue;
+    }
+    particles->pos[i] = pos;
+    i++;
+  }
+} // updateParticles()
+
+
+uint8_t emitBurst(uint16_t pos, uint8_t count, uint8_t speed, uint8_t hue, uint8_t life) {
+  uint8_t emitted = 0;
+  if(speed > 127)
+    speed = 127;
+
+  while(count--) {
+    // Velocity spread evenly over -speed to +speed, with a little hue and life variation so the burst sparkles.
+    int8_t vel = (int16_t)random8(speed * 2 + 1) - speed;
+    if(!emitParticle(pos, vel, hue + random8(16), life - random8(life >> 2)))
+      break;
+    emitted++;
+  }
+  return emitted;
+} // emitBurst()
+
+
+boolean emitSpray(uint16_t pos, int8_t vel, uint8_t spread, uint8_t hue, uint8_t life, uint8_t chance) {
+  if(random8() >= chance)
+    return false;
+  if(spread > 127)
+    spread = 127;
+
+  int16_t v = vel + (int16_t)random8(spread * 2 + 1) - spread;
+  return emitParticle(pos, constrain(v, -128, 127), hue, life);
+} // emitSpray()
+
+// End of file.
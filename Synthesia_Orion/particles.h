@@ -0,0 +1,42 @@
+#ifndef __SYNTHESIA_PARTICLES_H
+#define __SYNTHESIA_PARTICLES_H
+
+#include <Arduino.h>
+
+// Fixed pool particle system for sparks, comets and bursts.
+//
+// The pool is a set of parallel arrays (struct of arrays) so each pass only touches the fields it needs.
+// Live particles are always packed into slots 0 to count-1. A particle that dies is replaced by the
+// last live one, so updating and drawing cost time in proportion to the live particles, never the strip length.
+// There is no heap use. Each particle costs 5 bytes of SRAM.
+// tools/host_checks.py particles times updating and emitting at 8, 32 and 64 live particles.
+//
+// Position is 8.8 fixed point in pixels. Velocity is 4.4 fixed point in pixels per frame (up to +-8).
+// Hue is a colour wheel position scaled to 0-255. Life counts down to 0 and doubles as the particle's intensity.
+
+#ifndef PARTICLE_POOL_SIZE
+#define PARTICLE_POOL_SIZE 32
+#endif
+
+struct ParticlePool {
+  uint16_t pos[PARTICLE_POOL_SIZE];
+  int8_t   vel[PARTICLE_POOL_SIZE];
+  uint8_t  hue[PARTICLE_POOL_SIZE];
+  uint8_t  life[PARTICLE_POOL_SIZE];
+  uint8_t  count;
+};
+
+// The pool in use. It lives in the mode's state, so it only takes SRAM while a particle mode runs.
+extern ParticlePool *particles;
+
+void resetParticles(void *storage); // Empty the pool at storage (sizeof(ParticlePool) bytes) and make it current.
+boolean emitParticle(uint16_t pos, int8_t vel, uint8_t hue, uint8_t life);
+void updateParticles(uint8_t fade, int8_t gravity);
+
+// Emitters. Call them once per frame. When the pool is full they emit fewer particles, never fail.
+uint8_t emitBurst(uint16_t pos, uint8_t count, uint8_t speed, uint8_t hue, uint8_t life);  // Sprays in both directions.
+boolean emitSpray(uint16_t pos, int8_t vel, uint8_t spread, uint8_t hue, uint8_t life, uint8_t chance); // One particle, chance/256 per frame.
+
+#endif
+
+// End of file.
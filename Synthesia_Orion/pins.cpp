@@ -2,25 +2,25 @@
 
 void setupPins(void) {
   // Turn off all the LED's and the strip power before enabling these pins as outputs.
-  digitalWrite(PIN_LED_RED  , HIGH);
-  digitalWrite(PIN_LED_GREEN, HIGH);
-  digitalWrite(PIN_LED_BLUE , HIGH);
-  digitalWrite(PIN_STRIP_ENABLE, HIGH);
+  Pin<PIN_LED_RED>::high();
+  Pin<PIN_LED_GREEN>::high();
+  Pin<PIN_LED_BLUE>::high();
+  Pin<PIN_STRIP_ENABLE>::high();
 
-  // Default to 450mA charge current.
-  digitalWrite(PIN_CHARGE_HIGH, HIGH);
+  // Default to 450mA charge current. The charge control takes it from there.
+  Pin<PIN_CHARGE_HIGH>::write(CHARGE_PIN_450MA);
 
   // Set all pin directions with internal pullups enabled on the button pins.
-  pinMode(PIN_LED_RED     , OUTPUT);
-  pinMode(PIN_LED_GREEN   , OUTPUT);
-  pinMode(PIN_LED_BLUE    , OUTPUT);
-  pinMode(PIN_STRIP_ENABLE, OUTPUT);
-  pinMode(PIN_BUTTON_MODE , INPUT_PULLUP);
-  pinMode(PIN_BUTTON_SPEED, INPUT_PULLUP);
-  pinMode(PIN_BUTTON_LEVEL, INPUT_PULLUP);
-  pinMode(PIN_BUTTON_POWER, INPUT_PULLUP);
-  pinMode(PIN_CHARGE_HIGH , OUTPUT);
+  Pin<PIN_LED_RED>::output();
+  Pin<PIN_LED_GREEN>::output();
+  Pin<PIN_LED_BLUE>::output();
+  Pin<PIN_STRIP_ENABLE>::output();
+  Pin<PIN_BUTTON_MODE>::inputPullup();
+  Pin<PIN_BUTTON_SPEED>::inputPullup();
+  Pin<PIN_BUTTON_LEVEL>::inputPullup();
+  Pin<PIN_BUTTON_POWER>::inputPullup();
+  Pin<PIN_CHARGE_HIGH>::output();
 } // setupPins()
 
 // End of file.
-
+
@@ -13,11 +13,75 @@
 #define PIN_BUTTON_LEVEL  2
 #define PIN_BUTTON_POWER  3
 
+// Mode and speed are on pin change interrupt 0, which covers port B: pin 10 is PB6 (PCINT6), pin 17 is PB0 (PCINT0).
+// Level and power have external interrupts of their own, INT1 and INT0.
+#define BUTTON_MODE_PCINT_MASK  (1 << PCINT6)
+#define BUTTON_SPEED_PCINT_MASK (1 << PCINT0)
+
 // This pin allows power to flow to the LED strip.
 #define PIN_STRIP_ENABLE 13
 
+// Battery voltage through a 1:2 divider, on A5. Read by the fuel gauge through the sampler, as raw 32U4 channel
+// ADC0 (A5 is PF0).
 #define PIN_V_SENSE       5
+#define ADC_CHANNEL_V_SENSE 0
+
+// Optional electret microphone (biased to mid rail) for the audio reactive modes, on A2.
+// The sampler drives the ADC directly, so it also needs the raw 32U4 channel: A2 is PF5, ADC5.
+#define PIN_MIC_SENSE     2
+#define ADC_CHANNEL_MIC   5
+
+// Unconnected analog inputs. They are only read for their noise, to seed the random number generator.
+#define PIN_NOISE_SENSE_A 0
+#define PIN_NOISE_SENSE_B 1
+
+// Frame sync between units (see frameSync.h) uses the hardware UART, Serial1: RX on pin 0, TX on pin 1.
+// Pin 0 is also INT2, which timestamps the start of each beacon.
+#define PIN_SYNC_RX       0
+#define PIN_SYNC_TX       1
+
+// Charger current select. See chargeControl.h.
 #define PIN_CHARGE_HIGH  11
+#define CHARGE_PIN_450MA HIGH
+#define CHARGE_PIN_FAST  LOW
+
+// Pin<N>: direct access to Leonardo digital pin N. The port and bit are fixed at compile time, so high(), low()
+// and read() are each a single sbi, cbi or sbic/sbis instruction. digitalWrite() looks both up in PROGMEM tables,
+// checks for PWM and masks interrupts, around 50 cycles a call. All of ports B to E are in the low I/O space,
+// so these single bit writes are atomic and need no interrupt masking either.
+// A pin number with no entry below does not compile.
+template<uint8_t N> struct Pin;
+
+#define PIN_MAP(pin, port, bit) \
+  template<> struct Pin<pin> { \
+    static inline void high(void)        { PORT##port |= (1 << bit); } \
+    static inline void low(void)         { PORT##port &= ~(1 << bit); } \
+    static inline void write(uint8_t v)  { if(v) high(); else low(); } \
+    static inline boolean read(void)     { return (PIN##port & (1 << bit)) != 0; } \
+    static inline void output(void)      { DDR##port |= (1 << bit); } \
+    static inline void inputPullup(void) { DDR##port &= ~(1 << bit); high(); } \
+  };
+
+PIN_MAP( 0, D, 2)
+PIN_MAP( 1, D, 3)
+PIN_MAP( 2, D, 1)
+PIN_MAP( 3, D, 0)
+PIN_MAP( 4, D, 4)
+PIN_MAP( 5, C, 6)
+PIN_MAP( 6, D, 7)
+PIN_MAP( 7, E, 6)
+PIN_MAP( 8, B, 4)
+PIN_MAP( 9, B, 5)
+PIN_MAP(10, B, 6)
+PIN_MAP(11, B, 7)
+PIN_MAP(12, D, 6)
+PIN_MAP(13, C, 7)
+PIN_MAP(14, B, 3)
+PIN_MAP(15, B, 1)
+PIN_MAP(16, B, 2)
+PIN_MAP(17, B, 0)
+
+#undef PIN_MAP
 
 void setupPins(void);
 
@@ -0,0 +1,164 @@
+#include "pov.h"
+
+#if POV_SPI_DIVIDER == 2
+#define POV_SPI_CLOCK SPI_CLOCK_DIV2
+#else
+#define POV_SPI_CLOCK SPI_CLOCK_DIV4
+#endif
+
+// Cycles the interrupt takes on top of the bytes themselves: entry, exit and the loop's last byte.
+#define POV_OVERHEAD_CYCLES 120
+// A byte only starts once the loop has seen the last one finish and written SPDR.
+#define POV_BYTE_SLIP_CYCLES 3
+
+static const prog_uchar *__povFirst;   // First column
+static const prog_uchar *__povEnd;     // Just past the last column
+static const prog_uchar *__povColumn;  // Next column to send
+static uint16_t          __povColumnBytes;
+static uint8_t           __povLatchBytes;
+static uint16_t          __povRate;
+static volatile boolean  __povActive = false;
+
+// Timing since the last readPovTiming(), in Timer3 counts.
+static volatile uint16_t __povColumns;
+static volatile uint16_t __povEarliest = 0xFFFF; // Least and most time from the compare match to the first byte
+static volatile uint16_t __povLatest;
+static volatile uint16_t __povLength;            // Longest column
+static volatile uint16_t __povLate;              // Columns that overran into the next one's start
+
+
+static uint16_t povWord(const prog_uchar *p) {
+  return pgm_read_byte(p) | (pgm_read_byte(p + 1) << 8);
+} // povWord()
+
+
+// One column, flash to SPI. Each byte is fetched while the one before is still shifting out, so the bus never
+// waits on the loop. Only the column start has to be steady, so interrupts go back on once the first byte is
+// out: the UARTs, USB and the time base cannot wait a whole column. Anything that cuts in stretches the column
+// a little, which the length counts. This interrupt is masked meanwhile, so a late column cannot nest in itself.
+ISR(TIMER3_COMPA_vect) {
+  // In CTC mode the count restarts at the compare match, so it is the time this interrupt waited to run.
+  uint16_t start = TCNT3;
+
+  // The strip powering down has switched SPI off, and SPIF would never come.
+  if(!(SPCR & (1 << SPE)))
+    return;
+
+  const prog_uchar *p = __povColumn;
+  uint16_t n = __povColumnBytes;
+
+  SPDR = pgm_read_byte(p++);
+  TIMSK3 = 0;
+  sei();
+
+  while(--n)
+  {
+    uint8_t b = pgm_read_byte(p++);
+    while(!(SPSR & (1 << SPIF)));
+    SPDR = b;
+  }
+  for(uint8_t i = __povLatchBytes; i; i--)
+  {
+    while(!(SPSR & (1 << SPIF)));
+    SPDR = 0;
+  }
+  while(!(SPSR & (1 << SPIF)));
+
+  cli();
+  TIMSK3 = 1 << OCIE3A;
+  __povColumn = p == __povEnd ? __povFirst : p;
+
+  __povColumns++;
+  if(start < __povEarliest)
+    __povEarliest = start;
+  if(start > __povLatest)
+    __povLatest = start;
+  if(TIFR3 & (1 << OCF3A))
+  {
+    // The next compare match has been and gone, and the count with it.
+    __povLate++;
+  } else {
+    uint16_t length = TCNT3 - start;
+    if(length > __povLength)
+      __povLength = length;
+  }
+} // ISR()
+
+
+boolean startPov(const prog_uchar *image, LPD8806 &strip) {
+  stopPov();
+
+  if(pgm_read_byte(image) != 'O' || pgm_read_byte(image + 1) != 'P' || pgm_read_byte(image + 2) != POV_VERSION)
+    return false;
+  uint16_t pixels = povWord(image + 3);
+  uint16_t columns = povWord(image + 5);
+  uint16_t rate = povWord(image + 7);
+  if(!pixels || !columns || !rate || !strip.isEnabled())
+    return false;
+
+  // Latch for whichever is longer, the image or the strip, so the next column always starts at pixel 0.
+  uint16_t longest = pixels > strip.numPixels() ? pixels : strip.numPixels();
+  __povColumnBytes = pixels * 3;
+  __povLatchBytes = (longest + 31) / 32;
+  __povFirst = __povColumn = image + POV_HEADER_SIZE;
+  __povEnd = __povFirst + (uint32_t)columns * __povColumnBytes;
+
+  // 8 x POV_SPI_DIVIDER cycles a byte on the wire, at 16 cycles a microsecond.
+  uint32_t byteCycles = 8 * POV_SPI_DIVIDER + POV_BYTE_SLIP_CYCLES;
+  uint32_t columnUs = ((uint32_t)(__povColumnBytes + __povLatchBytes) * byteCycles + POV_OVERHEAD_CYCLES) / 16;
+  uint32_t periodUs = 1000000UL / rate;
+  uint32_t shortest = columnUs * 100 / POV_MAX_LOAD_PERCENT;
+  if(periodUs < shortest)
+    periodUs = shortest;
+  if(periodUs > POV_MAX_PERIOD_US)
+    periodUs = POV_MAX_PERIOD_US;
+  __povRate = 1000000UL / periodUs;
+
+  SPI.setClockDivider(POV_SPI_CLOCK);
+
+  // Timer3 in CTC mode at 16 MHz / 8, one compare match per column.
+  TCCR3A = 0;
+  TCCR3B = 0;
+  TCNT3  = 0;
+  OCR3A  = periodUs * POV_TIMER_PER_US - 1;
+  TIFR3  = (1 << OCF3A);
+  TIMSK3 = (1 << OCIE3A);
+  TCCR3B = (1 << WGM32) | (1 << CS31);
+  __povActive = true;
+  return true;
+} // startPov()
+
+
+void stopPov(void) {
+  TIMSK3 = 0;
+  TCCR3B = 0;
+  if(__povActive)
+    SPI.setClockDivider(SPI_CLOCK_DIV8); // Back to the frame rate clock, see LPD8806::startSPI()
+  __povActive = false;
+} // stopPov()
+
+
+boolean povActive(void) {
+  return __povActive;
+} // povActive()
+
+
+uint16_t povColumnRate(void) {
+  return __povActive ? __povRate : 0;
+} // povColumnRate()
+
+
+void readPovTiming(uint16_t *columns, uint16_t *earliest, uint16_t *latest, uint16_t *length, uint16_t *late) {
+  uint8_t sreg = SREG;
+  cli();
+  *columns  = __povColumns;
+  *earliest = __povColumns ? __povEarliest : 0;
+  *latest   = __povLatest;
+  *length   = __povLength;
+  *late     = __povLate;
+  __povColumns = __povLatest = __povLength = __povLate = 0;
+  __povEarliest = 0xFFFF;
+  SREG = sreg;
+} // readPovTiming()
+
+// End of file.
@@ -0,0 +1,47 @@
+#ifndef __SYNTHESIA_POV_H
+#define __SYNTHESIA_POV_H
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "LPD8806.h"
+
+// POV and light painting. An image is kept in flash as columns of ready to send strip bytes, made on a PC with
+// tools/pov_convert.py. Timer3 interrupts once per column, and the interrupt copies the column from flash
+// straight to the SPI data register, then the latch bytes. Nothing is drawn per column and the strip's buffer
+// is not used, so a column costs only its transfer. The LPD8806 latches each byte as it arrives (see
+// LPD8806.cpp), so the column is lit as it goes out. Columns loop back to the first after the last.
+//
+// Layout, all in PROGMEM:
+//   'O' 'P' <version> <pixels low> <pixels high> <columns low> <columns high> <columns/s low> <columns/s high>
+//   then each column: pixels x G R B, 7 bit with the high bit set, as LPD8806 takes them
+//
+// While it runs it owns the SPI bus, so showFrame() sends nothing. Interrupts are off from the compare match
+// until the column's first byte is on the wire, to keep the column start steady, and back on for the rest of it,
+// so frame sync beacons on Serial1 and USB serial are still served. The rate is capped at POV_MAX_LOAD_PERCENT
+// of the CPU. The columns bypass the
+// power limiter and the brightness setting: the converter scales the image to the power budget instead.
+//
+// SPI runs at 16 MHz / POV_SPI_DIVIDER while the image plays, faster than the 2 MHz used for frames. Each
+// column's interrupt latency (the column start jitter), its length and any column that started late are
+// counted for the energy profile (see energyProfile.h).
+
+#define POV_VERSION          1
+#define POV_HEADER_SIZE      9
+
+#ifndef POV_SPI_DIVIDER
+#define POV_SPI_DIVIDER      4  // 2 or 4. 8 is the frame rate clock.
+#endif
+#define POV_MAX_LOAD_PERCENT 75
+#define POV_TIMER_PER_US     2  // Timer3 at 16 MHz / 8
+#define POV_MAX_PERIOD_US    32767U
+
+boolean startPov(const prog_uchar *image, LPD8806 &strip); // False if the image is bad or the strip is not on
+void stopPov(void);
+boolean povActive(void);
+uint16_t povColumnRate(void); // Columns per second actually used, after the cap
+void readPovTiming(uint16_t *columns, uint16_t *earliest, uint16_t *latest, uint16_t *length, uint16_t *late);
+                              // Since the last read. Latency and length in timer counts of 0.5 us.
+
+#endif
+
+// End of file.
@@ -0,0 +1,301 @@
+// Generated by tools/pov_convert.py from --demo --pixels 32 --columns 48. Do not edit.
+// 4617 bytes. Played by pov(), see pov.h.
+
+#ifndef __SYNTHESIA_POV_DATA_H
+#define __SYNTHESIA_POV_DATA_H
+
+PROGMEM prog_uchar __povImage[] = {
+  0x4F, 0x50, 0x01, 0x20, 0x00, 0x30, 0x00, 0xF4, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80,
+  0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0xFF, 0x80,
+  0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81,
+  0xFF, 0x80, 0x81, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 0xFF, 0x80,
+  0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84,
+  0xFF, 0x80, 0x84, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0xFF, 0x80,
+  0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B,
+  0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x96, 0xFF, 0x80,
+  0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96,
+  0xFF, 0x80, 0x96, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA7, 0xFF, 0x80,
+  0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7,
+  0xFF, 0x80, 0xA7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xBE, 0xFF, 0x80,
+  0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE,
+  0xFF, 0x80, 0xBE, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xDB, 0xFF, 0x80,
+  0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB,
+  0xFF, 0x80, 0xDB, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xDB, 0x80,
+  0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF,
+  0xDB, 0x80, 0xFF, 0xDB, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xBE, 0x80,
+  0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF,
+  0xBE, 0x80, 0xFF, 0xBE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xA7, 0x80,
+  0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF,
+  0xA7, 0x80, 0xFF, 0xA7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x96, 0x80,
+  0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF,
+  0x96, 0x80, 0xFF, 0x96, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x8B, 0x80,
+  0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF,
+  0x8B, 0x80, 0xFF, 0x8B, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x84, 0x80,
+  0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF,
+  0x84, 0x80, 0xFF, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x81, 0x80,
+  0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF,
+  0x81, 0x80, 0xFF, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF,
+  0x80, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x81,
+  0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF,
+  0x80, 0x81, 0xFF, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x84,
+  0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF,
+  0x80, 0x84, 0xFF, 0x80, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x8B,
+  0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF,
+  0x80, 0x8B, 0xFF, 0x80, 0x8B, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x96,
+  0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF,
+  0x80, 0x96, 0xFF, 0x80, 0x96, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xA7,
+  0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF,
+  0x80, 0xA7, 0xFF, 0x80, 0xA7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xBE,
+  0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF,
+  0x80, 0xBE, 0xFF, 0x80, 0xBE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xDB,
+  0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF,
+  0x80, 0xDB, 0xFF, 0x80, 0xDB, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0xFF,
+  0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xDB, 0x80, 0xFF,
+  0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB,
+  0x80, 0xFF, 0xDB, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xBE, 0x80, 0xFF,
+  0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE,
+  0x80, 0xFF, 0xBE, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA7, 0x80, 0xFF,
+  0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7,
+  0x80, 0xFF, 0xA7, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x96, 0x80, 0xFF,
+  0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96,
+  0x80, 0xFF, 0x96, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B,
+  0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80,
+  0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF,
+  0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B,
+  0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80,
+  0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF,
+  0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x84, 0x80, 0xFF, 0x84,
+  0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80,
+  0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF,
+  0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84,
+  0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80,
+  0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF,
+  0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
+  0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80,
+  0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF,
+  0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81,
+  0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80,
+  0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0xFF,
+  0x81, 0x80, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF,
+  0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80,
+  0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80,
+  0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF, 0x80, 0x80, 0xFF,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81,
+  0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF,
+  0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80,
+  0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81,
+  0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x81, 0xFF, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84,
+  0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF,
+  0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80,
+  0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84,
+  0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x84, 0xFF, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B,
+  0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF,
+  0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80,
+  0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B,
+  0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x8B, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x96, 0xFF, 0x80, 0x96,
+  0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF,
+  0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80,
+  0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96,
+  0xFF, 0x80, 0x96, 0xFF, 0x80, 0x96, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xA7,
+  0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF,
+  0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80,
+  0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7, 0xFF, 0x80, 0xA7,
+  0xFF, 0x80, 0xA7, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF,
+  0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80,
+  0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE, 0xFF, 0x80, 0xBE,
+  0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF,
+  0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80,
+  0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0xDB, 0xFF, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF,
+  0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80,
+  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB,
+  0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80,
+  0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0xFF, 0xDB, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE,
+  0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80,
+  0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0xFF, 0xBE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0xA7,
+  0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80,
+  0xFF, 0xA7, 0x80, 0xFF, 0xA7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80, 0xFF, 0x96, 0x80,
+  0xFF, 0x96, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80, 0xFF, 0x8B, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80, 0xFF, 0x84, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x81, 0x80, 0xFF, 0x81, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+
+#endif
+
+// End of file.
@@ -0,0 +1,57 @@
+#include "powerLimiter.h"
+
+static uint16_t __powerBudget = POWER_BUDGET_MA;
+static uint16_t __scaleLimit = 256;
+static uint16_t __stripCurrent;
+
+// Output scale steps back towards full by 1/POWER_RECOVERY of the gap each frame.
+#define POWER_RECOVERY 16
+
+
+void setPowerBudget(uint16_t milliamps) {
+  __powerBudget = milliamps;
+} // setPowerBudget()
+
+
+uint16_t powerBudget(void) {
+  return __powerBudget;
+} // powerBudget()
+
+
+void setScaleLimit(uint16_t scale) {
+  __scaleLimit = scale > 256 ? 256 : scale;
+} // setScaleLimit()
+
+
+uint16_t estimateStripCurrent(uint16_t pixels, uint16_t channelSum) {
+  return ((uint32_t)pixels * STRIP_IDLE_UA_PER_PIXEL + (uint32_t)channelSum * STRIP_UA_PER_UNIT) / 1000;
+} // estimateStripCurrent()
+
+
+void limitStripPower(LPD8806 &strip, uint16_t channelSum) {
+  uint16_t idle  = ((uint32_t)strip.numPixels() * STRIP_IDLE_UA_PER_PIXEL) / 1000;
+  uint16_t drive = estimateStripCurrent(strip.numPixels(), channelSum) - idle;
+
+  // The idle draw cannot be scaled away, only the LED drive.
+  uint16_t target = 256;
+  if(idle + drive > __powerBudget)
+    target = __powerBudget > idle ? ((uint32_t)(__powerBudget - idle) << 8) / drive : 0;
+  if(target > __scaleLimit)
+    target = __scaleLimit;
+
+  uint16_t scale = strip.getScale();
+  if(target < scale)
+    scale = target;
+  else
+    scale += (target - scale + POWER_RECOVERY - 1) / POWER_RECOVERY;
+  strip.setScale(scale);
+
+  __stripCurrent = idle + (((uint32_t)drive * scale) >> 8);
+} // limitStripPower()
+
+
+uint16_t stripCurrent(void) {
+  return __stripCurrent;
+} // stripCurrent()
+
+// End of file.
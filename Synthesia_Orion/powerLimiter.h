@@ -0,0 +1,39 @@
+#ifndef __SYNTHESIA_POWER_LIMITER_H
+#define __SYNTHESIA_POWER_LIMITER_H
+
+#include <Arduino.h>
+#include "LPD8806.h"
+
+// Strip current estimate and limiter.
+//
+// Current is modelled from the frame about to be sent: a fixed draw per pixel for the LPD8806 drivers, plus a
+// draw per unit of channel value. The strip keeps the sum of its channel values up to date as pixels are set,
+// so the estimate costs a multiply per frame, not a pass over the pixels.
+// Fitted to the figures in orion.h, per meter (32 pixels) at full brightness:
+//   full white  32 x 3 x 127 = 12192 units  ->  32 mA + 12192 x 38 uA = 495 mA   (measured 500 mA)
+//   rainbow     32 x 127     =  4064 units  ->  32 mA +  4064 x 38 uA = 186 mA   (measured 200 mA)
+//
+// When the estimate is over the budget, the strip's output scale is cut to fit before the frame goes out.
+// It drops at once, since a brownout is worse than a dim frame, and recovers over a few dozen frames.
+// Modes that stay under the budget are never touched.
+//
+// Apart from the budget, the scale can be capped outright, e.g. by the battery gauge as the cell runs down
+// (see batteryStatus.h). The cap dims every mode by the same fraction, whatever it draws.
+
+#define STRIP_IDLE_UA_PER_PIXEL  1000 // Drivers, with every LED off
+#define STRIP_UA_PER_UNIT          38 // Per unit of channel value (0-127) at full scale
+
+#ifndef POWER_BUDGET_MA
+#define POWER_BUDGET_MA          1500 // What the battery and wiring can supply without sagging
+#endif
+
+void setPowerBudget(uint16_t milliamps);
+uint16_t powerBudget(void);
+void setScaleLimit(uint16_t scale);                                 // Cap on the output scale, 256 (the default) is none
+uint16_t estimateStripCurrent(uint16_t pixels, uint16_t channelSum); // mA at full scale
+void limitStripPower(LPD8806 &strip, uint16_t channelSum);          // Call just before every show()
+uint16_t stripCurrent(void);                                        // mA of the last frame, after limiting
+
+#endif
+
+// End of file.
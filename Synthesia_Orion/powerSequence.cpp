@@ -0,0 +1,104 @@
+#include "powerSequence.h"
+#include "orion.h"
+#include "batteryStatus.h"
+#include "scheduler.h"
+#include "settings.h"
+#include "timeBase.h"
+#include "pov.h"
+#include <avr/sleep.h>
+
+static uint8_t       __powerState = POWER_OFF;
+static unsigned long __settleStart;     // timeMillis() the strip supply went on
+static volatile unsigned long __pressTime; // timeMicros() of the last power button press
+static boolean       __firstFrame;      // Waiting for the first frame after power on
+static unsigned long __powerOnLatency;
+
+
+void notePowerPress(void) {
+  __pressTime = timeMicros();
+  wakeTasks();
+} // notePowerPress()
+
+
+boolean updatePowerSequence(boolean poweredOn) {
+  if(!poweredOn)
+  {
+    if(__powerState == POWER_OFF)
+      return false;
+
+    if(__powerState != POWER_STOPPING)
+    {
+      saveSettings();
+      stopPov();
+      disable();
+      // Ensure that the status LED is off
+      forceStatusLightOff();
+      __powerState = POWER_STOPPING;
+    }
+
+    // The log task writes the settings out. Power down now and they would be lost with the battery.
+    if(settingsPending())
+    {
+      wakeBy(timeMicros() + 3400);
+      return false;
+    }
+    __powerState = POWER_OFF;
+
+    // Sleep until the power button wakes us.
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    sleep_mode();  //sleep now
+    sleep_disable(); //fully awake now
+    return true;
+  }
+
+  switch(__powerState)
+  {
+    case POWER_STOPPING:
+    case POWER_OFF:
+      powerUpStrip();
+      __settleStart = timeMillis();
+      __firstFrame = true;
+      // Have the first frame drawn now, while the rail comes up.
+      resetAnimationClock();
+      __powerState = POWER_SETTLING;
+      return true;
+
+    case POWER_SETTLING:
+      if(timeMillis() - __settleStart < STRIP_SETTLE_MS)
+      {
+        wakeBy(timeMicros() + (STRIP_SETTLE_MS - (timeMillis() - __settleStart)) * 1000UL);
+        return false;
+      }
+      enable(true);
+      __powerState = POWER_ON;
+      return true;
+  }
+  return false;
+} // updatePowerSequence()
+
+
+boolean stripReady(void) {
+  return __powerState == POWER_ON;
+} // stripReady()
+
+
+void notePowerFrameShown(void) {
+  if(!__firstFrame)
+    return;
+
+  uint8_t oldSREG = SREG;
+  cli();
+  unsigned long pressTime = __pressTime;
+  SREG = oldSREG;
+
+  __powerOnLatency = timeMicros() - pressTime;
+  __firstFrame = false;
+} // notePowerFrameShown()
+
+
+unsigned long powerOnLatency(void) {
+  return __powerOnLatency;
+} // powerOnLatency()
+
+// End of file.
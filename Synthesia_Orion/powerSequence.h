@@ -0,0 +1,36 @@
+#ifndef __SYNTHESIA_POWER_SEQUENCE_H
+#define __SYNTHESIA_POWER_SEQUENCE_H
+
+#include <Arduino.h>
+
+// Power sequencing, run by the power task. The power button ISR only flips poweredOn and stamps the time.
+//
+//   OFF       Strip supply off. The CPU sleeps in power down until the power button wakes it.
+//   SETTLING  Strip supply on, waiting STRIP_SETTLE_MS for the rail. The first frame is drawn meanwhile.
+//   ON        Strip enabled. Frames go out.
+//   STOPPING  Strip and status light dark, the settings still going out to EEPROM. Then OFF.
+//
+// Nothing waits: the scheduler sleeps through the settling time and the settings write like any other idle
+// time. Switching off saves the settings (see settings.h) before the strip and status light go dark.
+// The time from the power button to the first frame shown is kept as powerOnLatency().
+
+#ifndef STRIP_SETTLE_MS
+#define STRIP_SETTLE_MS 50 // The old enable() waited 250 ms, far more than the supply needs.
+#endif
+
+enum {
+  POWER_OFF,
+  POWER_SETTLING,
+  POWER_ON,
+  POWER_STOPPING
+};
+
+void notePowerPress(void);                 // From the power button ISR
+boolean updatePowerSequence(boolean poweredOn); // Polled. True if the state changed.
+boolean stripReady(void);                  // True once frames can be sent
+void notePowerFrameShown(void);            // After every frame shown
+unsigned long powerOnLatency(void);        // Microseconds, power button to first frame, for the last power on
+
+#endif
+
+// End of file.
@@ -0,0 +1,159 @@
+#include "scheduler.h"
+#include "timeBase.h"
+
+static Task          *__tasks;
+static byte           __taskCount;
+static unsigned long  __windowStart; // timeMicros() at the start of the accounting window
+static unsigned long  __idleTime;    // Microseconds idle this window
+static byte           __idleLoad;
+static boolean        __wakeRequested; // A polled task asked to be woken at __wakeMicros
+static unsigned long  __wakeMicros;
+static volatile boolean __taskWake;   // An interrupt has brought work since the pass started
+static TaskFunction   __inputWaiting;
+
+
+void startTasks(Task *tasks, byte count, TaskFunction inputWaiting) {
+  __tasks = tasks;
+  __taskCount = count;
+  __inputWaiting = inputWaiting;
+
+  unsigned long now = timeMillis();
+  for(byte i = 0; i < count; i++)
+  {
+    tasks[i].release = now;
+    tasks[i].runTime = 0;
+    tasks[i].worstTime = 0;
+    tasks[i].misses = 0;
+    tasks[i].load = 0;
+  }
+
+  __windowStart = timeMicros();
+  __idleTime = 0;
+  __idleLoad = 0;
+} // startTasks()
+
+
+// With interrupts off, just before sleeping: has anything come in since the tasks looked?
+static boolean tasksPending(void) {
+  return __taskWake || (__inputWaiting && __inputWaiting());
+} // tasksPending()
+
+
+void runTasks(void) {
+  unsigned long now = timeMillis();
+  boolean busy = false;
+
+  __wakeRequested = false;
+  __taskWake = false;
+
+  // Offer the pass to each priority level in turn. Periodic tasks only when they are due.
+  // The first task that does some work ends the pass.
+  for(byte priority = 0; !busy && priority < 255; priority++)
+  {
+    boolean anyLeft = false;
+
+    for(byte i = 0; i < __taskCount && !busy; i++)
+    {
+      Task *task = &__tasks[i];
+      if(task->priority > priority)
+        anyLeft = true;
+      if(task->priority != priority)
+        continue;
+      if(task->period && (long)(now - task->release) < 0)
+        continue;
+
+      if(task->period)
+      {
+        if(task->deadline && now - task->release > task->deadline)
+          task->misses++;
+        // Release again one period on from this release, or from now if the task has fallen a whole period behind.
+        task->release += task->period;
+        if((long)(now - task->release) >= 0)
+          task->release = now + task->period;
+      }
+
+      unsigned long start = timeMicros();
+      busy = task->run() || task->period;
+      unsigned long spent = timeMicros() - start;
+
+      task->runTime += spent;
+      if(spent > task->worstTime)
+        task->worstTime = spent > 0xFFFF ? 0xFFFF : spent;
+    }
+
+    if(!anyLeft)
+      break;
+  }
+
+  if(busy)
+    return;
+
+  // Nothing to do. Sleep until the next release or the time a polled task asked for, whichever is first.
+  // A button press or any other interrupt wakes the CPU early and the next pass picks it up.
+  unsigned long start = timeMicros();
+  long untilRelease = 1000; // Never sleep more than a second without looking round
+  for(byte i = 0; i < __taskCount; i++)
+  {
+    if(!__tasks[i].period)
+      continue;
+    long wait = (long)(__tasks[i].release - now);
+    if(wait < untilRelease)
+      untilRelease = wait;
+  }
+
+  unsigned long wake = start + (untilRelease > 0 ? (unsigned long)untilRelease * 1000 : 0);
+  if(__wakeRequested && (long)(__wakeMicros - wake) < 0)
+    wake = __wakeMicros;
+
+  sleepUntil(wake, tasksPending);
+  __idleTime += timeMicros() - start;
+} // runTasks()
+
+
+// From an interrupt that has left work for a polled task.
+void wakeTasks(void) {
+  __taskWake = true;
+} // wakeTasks()
+
+
+// Called by a polled task that has nothing to do yet, to say when it will.
+void wakeBy(unsigned long atMicros) {
+  if(!__wakeRequested || (long)(atMicros - __wakeMicros) < 0)
+    __wakeMicros = atMicros;
+  __wakeRequested = true;
+} // wakeBy()
+
+
+// Turn this window's run times into load percentages, then start a new window. Call it about once a second.
+void updateTaskLoads(void) {
+  unsigned long window = timeMicros() - __windowStart;
+  if(window == 0)
+    return;
+  window = window / 100 + 1; // Microseconds per percent, rounded so no load reaches 101
+
+  for(byte i = 0; i < __taskCount; i++)
+  {
+    __tasks[i].load = __tasks[i].runTime / window;
+    __tasks[i].runTime = 0;
+    __tasks[i].worstTime = 0;
+  }
+  __idleLoad = __idleTime / window;
+
+  __idleTime = 0;
+  __windowStart = timeMicros();
+} // updateTaskLoads()
+
+
+byte idleLoad(void) {
+  return __idleLoad;
+} // idleLoad()
+
+
+uint16_t deadlineMisses(void) {
+  uint16_t misses = 0;
+  for(byte i = 0; i < __taskCount; i++)
+    misses += __tasks[i].misses;
+  return misses;
+} // deadlineMisses()
+
+// End of file.
@@ -0,0 +1,50 @@
+#ifndef __SYNTHESIA_SCHEDULER_H
+#define __SYNTHESIA_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Cooperative task scheduler. Replaces the old superloop where loop() called everything back to back.
+//
+// Each pass of runTasks() runs the most urgent task that is due: the lowest priority number, then the
+// first in the table. It then returns, so a high priority task never waits behind more than one other task.
+// Tasks with a period of 0 are polled on every pass. They are driven by interrupts (button events,
+// the animation clock) and return false when there was nothing to do.
+// A pass where no task did any work counts as idle time. The CPU sleeps (see timeBase.h) until the next periodic
+// release, or until the time a polled task passed to wakeBy(), or until any interrupt.
+// An interrupt that leaves work for a polled task calls wakeTasks(). If one comes in after the tasks were polled,
+// the pass does not sleep. Input that arrives through the Arduino core's own interrupts (USB serial, the UART) is
+// covered by the inputWaiting function given to startTasks(), which is called with interrupts off.
+//
+// Every task is released from the one time base in timeBase.h. A periodic task that starts more
+// than deadline ms after its release counts a deadline miss. Run time is accounted per task in microseconds.
+// updateTaskLoads() rolls it up into load percentages over the last window.
+
+typedef boolean (*TaskFunction)(void); // Returns true if the task did any work.
+
+struct Task {
+  TaskFunction  run;
+  uint16_t      period;      // ms between releases. 0 to poll every pass.
+  byte          priority;    // 0 is the most urgent.
+  uint16_t      deadline;    // ms after release the task must have started by. 0 for no deadline.
+
+  // Kept by the scheduler.
+  unsigned long release;     // timeMillis() of the next release
+  unsigned long runTime;     // Microseconds spent in the task this window
+  uint16_t      worstTime;   // Longest single run this window, in microseconds (saturates)
+  uint16_t      misses;      // Deadline misses since power up
+  byte          load;        // Percent of the last window spent in the task
+};
+
+#define TASK(run, period, priority, deadline) { run, period, priority, deadline, 0, 0, 0, 0, 0 }
+
+void startTasks(Task *tasks, byte count, TaskFunction inputWaiting); // inputWaiting may be 0
+void runTasks(void);
+void wakeBy(unsigned long atMicros); // For polled tasks: there is nothing to do until timeMicros() reaches atMicros.
+void wakeTasks(void);                // From interrupts: a polled task has work
+void updateTaskLoads(void);
+byte idleLoad(void); // Percent of the last window spent idle
+uint16_t deadlineMisses(void); // All tasks, since power up
+
+#endif
+
+// End of file.
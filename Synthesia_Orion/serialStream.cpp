@@ -0,0 +1,200 @@
+#include "serialStream.h"
+#include "telemetryLog.h"
+#include "timeBase.h"
+
+enum {
+  STREAM_HUNT,      // Waiting for 'A'
+  STREAM_MAGIC,     // Waiting for 'd'
+  STREAM_TYPE,
+  STREAM_COUNT_HIGH,
+  STREAM_COUNT_LOW,
+  STREAM_CHECK,
+  STREAM_RUN,       // RLE run length, or delta skip
+  STREAM_LENGTH,    // Delta length
+  STREAM_PIXEL      // Channel bytes
+};
+
+static uint8_t       __streamState = STREAM_HUNT;
+static uint8_t       __streamType;
+static uint8_t       __countHigh;
+static uint16_t      __pixelsLeft;  // Pixels still to come in this frame
+static uint16_t      __pixel;       // Next pixel to write
+static uint8_t       __runLeft;     // Pixels left in this RLE run or delta span
+static uint8_t       __channel;     // 0-2 within the pixel
+static uint8_t       __rgb[3];
+static boolean       __ackPending;
+static unsigned long __lastFrame;   // timeMillis() of the last complete frame
+static unsigned long __lastByte;    // timeMillis() of the last byte received
+static boolean       __streaming;
+static uint8_t       __commandMatched; // Bytes of STREAM_DUMP_COMMAND seen in a row while hunting
+
+
+// One pixel is in. Write it, or for RLE the whole run. True when that was the last pixel of the frame.
+static boolean storePixels(LPD8806 &strip, uint8_t count) {
+  while(count--)
+  {
+    if(__pixel < strip.numPixels())
+      strip.setPixelColor(__pixel, __rgb[0] >> 1, __rgb[1] >> 1, __rgb[2] >> 1);
+    __pixel++;
+    __pixelsLeft--;
+  }
+  return __pixelsLeft == 0;
+} // storePixels()
+
+
+// Feed one byte to the parser. True when it completes a frame.
+static boolean parseStreamByte(LPD8806 &strip, uint8_t b) {
+  switch(__streamState)
+  {
+    case STREAM_HUNT:
+      if(b == 'A')
+      {
+        __streamState = STREAM_MAGIC;
+        __commandMatched = 0;
+        return false;
+      }
+      // Not one byte: the parser also hunts through the pixel data of a frame it lost, and any byte turns up there.
+      if(b != STREAM_DUMP_COMMAND[__commandMatched])
+        __commandMatched = b == STREAM_DUMP_COMMAND[0];
+      else if(++__commandMatched == sizeof(STREAM_DUMP_COMMAND) - 1)
+      {
+        __commandMatched = 0;
+        dumpTelemetryLog();
+      }
+      return false;
+
+    case STREAM_MAGIC:
+      __streamState = b == 'd' ? STREAM_TYPE : b == 'A' ? STREAM_MAGIC : STREAM_HUNT;
+      return false;
+
+    case STREAM_TYPE:
+      __streamType = b;
+      __streamState = (b == 'a' || b == 'r' || b == 'd') ? STREAM_COUNT_HIGH : STREAM_HUNT;
+      return false;
+
+    case STREAM_COUNT_HIGH:
+      __countHigh = b;
+      __streamState = STREAM_COUNT_LOW;
+      return false;
+
+    case STREAM_COUNT_LOW:
+      __pixelsLeft = ((uint16_t)__countHigh << 8 | b) + 1;
+      __channel = __countHigh ^ b ^ 0x55; // Expected check byte, kept here until it arrives
+      __streamState = STREAM_CHECK;
+      return false;
+
+    case STREAM_CHECK:
+      if(b != __channel)
+      {
+        __streamState = b == 'A' ? STREAM_MAGIC : STREAM_HUNT;
+        return false;
+      }
+      __pixel = 0;
+      __channel = 0;
+      __runLeft = 1;
+      __streamState = __streamType == 'a' ? STREAM_PIXEL : STREAM_RUN;
+      return false;
+
+    case STREAM_RUN:
+      if(__streamType == 'r')
+      {
+        // A run of 0 or one past the end of the frame means the sender and parser disagree. Drop the frame.
+        if(b == 0 || b > __pixelsLeft)
+        {
+          __streamState = STREAM_HUNT;
+          return false;
+        }
+        __runLeft = b;
+        __streamState = STREAM_PIXEL;
+        return false;
+      }
+      if(b > __pixelsLeft)
+      {
+        __streamState = STREAM_HUNT;
+        return false;
+      }
+      __pixel += b;
+      __pixelsLeft -= b;
+      if(__pixelsLeft == 0)
+      {
+        __streamState = STREAM_HUNT;
+        return true;
+      }
+      __streamState = STREAM_LENGTH;
+      return false;
+
+    case STREAM_LENGTH:
+      if(b == 0 || b > __pixelsLeft)
+      {
+        __streamState = b == 0 ? STREAM_RUN : STREAM_HUNT;
+        return false;
+      }
+      __runLeft = b;
+      __streamState = STREAM_PIXEL;
+      return false;
+
+    default: // STREAM_PIXEL
+      __rgb[__channel++] = b;
+      if(__channel < 3)
+        return false;
+      __channel = 0;
+
+      if(__streamType == 'r')
+      {
+        // The whole run takes this colour.
+        boolean done = storePixels(strip, __runLeft);
+        __streamState = done ? STREAM_HUNT : STREAM_RUN;
+        return done;
+      }
+
+      boolean done = storePixels(strip, 1);
+      if(done)
+        __streamState = STREAM_HUNT;
+      else if(__streamType == 'd' && --__runLeft == 0)
+        __streamState = STREAM_RUN;
+      return done;
+  }
+} // parseStreamByte()
+
+
+boolean receiveStream(LPD8806 &strip) {
+  if(__streaming && timeMillis() - __lastFrame >= STREAM_TIMEOUT_MS)
+    __streaming = false;
+  // A host that stops halfway through a frame must not hold the modes off for good.
+  if(streamReceiving() && timeMillis() - __lastByte >= STREAM_TIMEOUT_MS)
+    __streamState = STREAM_HUNT;
+
+  for(uint8_t n = 0; n < STREAM_BYTES_PER_PASS && Serial.available(); n++)
+  {
+    __lastByte = timeMillis();
+    if(parseStreamByte(strip, Serial.read()))
+    {
+      __lastFrame = timeMillis();
+      __streaming = true;
+      __ackPending = true;
+      return true;
+    }
+  }
+  return false;
+} // receiveStream()
+
+
+boolean streamActive(void) {
+  return __streaming;
+} // streamActive()
+
+
+// Past a good header, the parser is writing into the strip buffer.
+boolean streamReceiving(void) {
+  return __streamState > STREAM_CHECK;
+} // streamReceiving()
+
+
+void streamFrameShown(void) {
+  if(!__ackPending)
+    return;
+  Serial.write(STREAM_ACK);
+  __ackPending = false;
+} // streamFrameShown()
+
+// End of file.
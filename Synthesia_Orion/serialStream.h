@@ -0,0 +1,48 @@
+#ifndef __SYNTHESIA_SERIAL_STREAM_H
+#define __SYNTHESIA_SERIAL_STREAM_H
+
+#include <Arduino.h>
+#include "LPD8806.h"
+
+// Host driven frames over USB serial, for a lighting desk to drive the belt directly.
+//
+// Frames use the Adalight header, so Adalight senders work unchanged:
+//
+//   'A' 'd' <type> <count high> <count low> <count high ^ count low ^ 0x55> <payload>
+//
+// count is the number of pixels minus one. Adalight's own type is 'a'. The others are additions:
+//   'a'  raw:   count+1 pixels of R G B
+//   'r'  RLE:   runs of <length 1-255> R G B until count+1 pixels are covered
+//   'd'  delta: <skip> <length> then length pixels of R G B, repeated until count+1 pixels are covered.
+//               Skipped pixels keep the last frame's colour.
+// Channels are 8 bit and are sent to the strip at 7. Gamma is up to the host. Pixels past the end of the strip
+// are read and dropped.
+//
+// The parser writes each pixel into the strip's buffer as soon as its three bytes are in, with no frame copy
+// in between. A complete frame goes out through showFrame() like any drawn frame, power limited as usual, and
+// the unit answers '#' when it has been sent, for the host to pace itself and time the round trip.
+// A header that fails its check is dropped, and the parser hunts for the next 'A'.
+//
+// While frames keep coming the modes are paused. STREAM_TIMEOUT_MS after the last one, the current mode resumes.
+// The first frame pauses them too, from the moment its header checks out, so no mode draws over pixels already in.
+// A frame that stops coming for STREAM_TIMEOUT_MS is dropped.
+//
+// The parser owns the serial input. STREAM_DUMP_COMMAND between frames asks for the telemetry log dump
+// (see telemetryLog.h).
+//
+// tools/host_checks.py stream feeds this parser good and broken frames over a pty, and tools/stream_sender.py
+// measures frame rate and latency against a unit or, with --loopback, the same build.
+
+#define STREAM_TIMEOUT_MS  2000
+#define STREAM_BYTES_PER_PASS 64 // Bytes parsed per call, so a flood of data cannot hold up the other tasks
+#define STREAM_ACK         '#'
+#define STREAM_DUMP_COMMAND "dump" // No 'A' in it, so it cannot be mistaken for the start of a frame
+
+boolean receiveStream(LPD8806 &strip); // Polled. True when a frame has just been completed.
+boolean streamActive(void);
+boolean streamReceiving(void);         // True while a frame is coming in
+void streamFrameShown(void);           // After a completed frame has been sent
+
+#endif
+
+// End of file.
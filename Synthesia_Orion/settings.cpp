@@ -0,0 +1,119 @@
+#include "settings.h"
+#include "orion.h"
+#include <avr/eeprom.h>
+
+extern int mode, syspeed, brightness; // orion.cpp
+
+struct SettingsRecord {
+  uint8_t version;
+  uint8_t modeCount;   // A different mode list makes the saved mode number meaningless
+  uint8_t mode;
+  uint8_t speed;
+  uint8_t brightness;
+  uint8_t check;       // Sum of the bytes above, inverted
+};
+
+static SettingsRecord __saved;            // Last record saved, or going out
+static uint8_t __settingsBytes;          // Bytes of __saved still to write, 0 when there are none
+static uint8_t __settingsStable; // Seconds the settings have differed from __saved without changing again
+static int __lastMode, __lastSpeed, __lastBrightness;
+
+
+static uint8_t settingsCheck(const SettingsRecord *record) {
+  const uint8_t *bytes = (const uint8_t *)record;
+  uint8_t sum = 0;
+  for(uint8_t i = 0; i < sizeof(SettingsRecord) - 1; i++)
+    sum += bytes[i];
+  return ~sum;
+} // settingsCheck()
+
+
+static void currentSettings(SettingsRecord *record) {
+  record->version = SETTINGS_VERSION;
+  record->modeCount = modeCount();
+  record->mode = mode;
+  record->speed = syspeed;
+  record->brightness = brightness;
+  record->check = settingsCheck(record);
+} // currentSettings()
+
+
+void loadSettings(void) {
+  SettingsRecord record;
+  eeprom_read_block(&record, (const void *)SETTINGS_ADDRESS, sizeof(record));
+
+  if(record.check == settingsCheck(&record) && record.version == SETTINGS_VERSION
+    && record.modeCount == modeCount() && record.mode < modeCount()
+    && record.speed <= NUMBER_SPEED_SETTINGS
+    && record.brightness >= 1 && record.brightness <= NUMBER_BRIGHTNESS_LEVELS)
+  {
+    mode = record.mode;
+    syspeed = record.speed;
+    brightness = record.brightness;
+  }
+
+  currentSettings(&__saved);
+  __lastMode = mode;
+  __lastSpeed = syspeed;
+  __lastBrightness = brightness;
+} // loadSettings()
+
+
+void saveSettings(void) {
+  SettingsRecord record;
+  currentSettings(&record);
+  if(!memcmp(&record, &__saved, sizeof(record)))
+    return;
+
+  // A save still going out starts again with the new record.
+  __saved = record;
+  __settingsBytes = sizeof(record);
+  __settingsStable = 0;
+} // saveSettings()
+
+
+// Check byte last, so a save cut short by a power loss reads back as no record rather than a wrong one.
+boolean writeSettings(void) {
+  while(__settingsBytes)
+  {
+    if(!eeprom_is_ready())
+      return false;
+
+    uint8_t i = sizeof(SettingsRecord) - __settingsBytes;
+    uint8_t *address = (uint8_t *)SETTINGS_ADDRESS + i;
+    uint8_t value = ((uint8_t *)&__saved)[i];
+    __settingsBytes--;
+    if(eeprom_read_byte(address) != value)
+    {
+      eeprom_write_byte(address, value);
+      return true;
+    }
+  }
+  return false;
+} // writeSettings()
+
+
+boolean settingsPending(void) {
+  return __settingsBytes != 0;
+} // settingsPending()
+
+
+// Wait for the buttons to settle, so stepping through ten modes to reach one is one save, not ten.
+void updateSettings(void) {
+  if(mode != __lastMode || syspeed != __lastSpeed || brightness != __lastBrightness)
+  {
+    __lastMode = mode;
+    __lastSpeed = syspeed;
+    __lastBrightness = brightness;
+    __settingsStable = 0;
+    return;
+  }
+
+  if(__saved.mode == mode && __saved.speed == syspeed && __saved.brightness == brightness)
+    return;
+
+  if(++__settingsStable >= SETTINGS_SAVE_DELAY)
+    saveSettings();
+} // updateSettings()
+
+// End of file.
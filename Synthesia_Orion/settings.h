@@ -0,0 +1,27 @@
+#ifndef __SYNTHESIA_SETTINGS_H
+#define __SYNTHESIA_SETTINGS_H
+
+#include <Arduino.h>
+
+// Saved settings. The mode, speed and brightness go into the EEPROM below TELEMETRY_LOG_START, so the unit comes
+// back the way it was left, even after the battery has been out.
+//
+// They are saved when the unit is switched off, and SETTINGS_SAVE_DELAY seconds after the last change while it
+// is on. Only bytes that changed are written, so a press that is stepped back costs nothing.
+// saveSettings() only stages the record. writeSettings(), polled from the log task with the telemetry log, writes
+// it a byte at a time and never waits on the EEPROM; six bytes at once would stall the frame for 20 ms.
+// A record that fails its check (blank EEPROM, or a different mode list) is ignored and the defaults stand.
+
+#define SETTINGS_ADDRESS      0
+#define SETTINGS_VERSION   0x01 // Bump when the record changes
+#define SETTINGS_SAVE_DELAY  10
+
+void loadSettings(void);     // From setupOrion(), after the defaults are set
+void saveSettings(void);
+void updateSettings(void);   // Once a second
+boolean writeSettings(void); // Polled. True if it wrote a byte.
+boolean settingsPending(void); // True while a save is still going out
+
+#endif
+
+// End of file.
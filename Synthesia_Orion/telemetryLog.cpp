@@ -0,0 +1,166 @@
+#include "telemetryLog.h"
+#include "orion.h"
+#include "scheduler.h"
+#include "batteryStatus.h"
+#include "chargeControl.h"
+#include <avr/eeprom.h>
+
+extern int mode, syspeed, brightness; // orion.cpp
+extern byte renderQuality;
+
+static uint8_t  __logHead;        // Slot the next record goes in
+static uint8_t  __logSequence;    // Its sequence number
+static TelemetryRecord __staged;  // Waiting to be written
+static uint8_t  __stagedBytes;    // Bytes of __staged still to write, 0 when there is none
+
+// This period so far.
+static uint16_t __logSeconds;
+static uint32_t __logFrames;
+static uint16_t __logMisses;      // deadlineMisses() at the start of the period
+static uint16_t __logMillivolts;  // Lowest seen, 0 for none yet
+static uint16_t __logScale;       // Lowest seen
+static boolean  __logReduced;
+
+
+static uint8_t *slotAddress(uint8_t slot) {
+  return (uint8_t *)(TELEMETRY_LOG_START + slot * sizeof(TelemetryRecord));
+} // slotAddress()
+
+
+static uint8_t slotSequence(uint8_t slot) {
+  return eeprom_read_byte(slotAddress(slot));
+} // slotSequence()
+
+
+static void startTelemetryPeriod(void) {
+  __logSeconds = 0;
+  __logFrames = 0;
+  __logMisses = deadlineMisses();
+  __logMillivolts = 0;
+  __logScale = 256;
+  __logReduced = false;
+} // startTelemetryPeriod()
+
+
+// The newest record is the last one whose successor does not carry the next sequence number.
+void startTelemetryLog(void) {
+  __logHead = 0;
+  __logSequence = 0;
+
+  uint8_t sequence = slotSequence(0);
+  if(sequence != 0xFF)
+  {
+    uint8_t slot = 0;
+    while(slot + 1 < TELEMETRY_RECORDS)
+    {
+      uint8_t next = slotSequence(slot + 1);
+      if(next != (sequence + 1) % TELEMETRY_SEQUENCE_MAX)
+        break;
+      sequence = next;
+      slot++;
+    }
+    __logHead = (slot + 1) % TELEMETRY_RECORDS;
+    __logSequence = (sequence + 1) % TELEMETRY_SEQUENCE_MAX;
+  }
+
+  startTelemetryPeriod();
+} // startTelemetryLog()
+
+
+void countTelemetryFrame(uint16_t scale) {
+  __logFrames++;
+  if(scale < __logScale)
+    __logScale = scale;
+  if(renderQuality != QUALITY_FULL)
+    __logReduced = true;
+} // countTelemetryFrame()
+
+
+static void stageTelemetryRecord(boolean poweredOn) {
+  uint16_t misses = deadlineMisses() - __logMisses;
+  uint32_t fps = (__logFrames + __logSeconds / 2) / __logSeconds;
+
+  __staged.sequence = __logSequence;
+  __staged.mode     = mode;
+  __staged.settings = (syspeed << 4) | (brightness & 0x0F);
+  __staged.battery  = __logMillivolts / 20 > 255 ? 255 : __logMillivolts / 20;
+  __staged.fps      = fps > 255 ? 255 : fps;
+  __staged.misses   = misses > 255 ? 255 : misses;
+  __staged.limiter  = __logScale > 255 ? 255 : __logScale;
+  __staged.flags    = (chargePhase() << 5)
+                    | (poweredOn ? TELEMETRY_POWERED : 0)
+                    | (usbPowered() ? TELEMETRY_USB : 0)
+                    | (__logReduced ? TELEMETRY_QUALITY : 0);
+  __stagedBytes = sizeof(TelemetryRecord);
+} // stageTelemetryRecord()
+
+
+// Print the ring oldest first. The oldest record is the one the next write will replace.
+void dumpTelemetryLog(void) {
+  for(uint8_t i = 0; i < TELEMETRY_RECORDS; i++)
+  {
+    uint8_t slot = (__logHead + i) % TELEMETRY_RECORDS;
+    uint8_t *address = slotAddress(slot);
+    if(eeprom_read_byte(address) == 0xFF)
+      continue;
+
+    Serial.print("T ");
+    Serial.print(slot);
+    Serial.print(' ');
+    for(uint8_t b = 0; b < sizeof(TelemetryRecord); b++)
+    {
+      uint8_t value = eeprom_read_byte(address + b);
+      if(value < 0x10)
+        Serial.print('0');
+      Serial.print(value, HEX);
+    }
+    Serial.println();
+  }
+  Serial.println("T end");
+} // dumpTelemetryLog()
+
+
+void updateTelemetryLog(boolean poweredOn) {
+  // Nothing worth keeping while the unit is off and on its battery.
+  if(!poweredOn && !usbPowered())
+  {
+    startTelemetryPeriod();
+    return;
+  }
+
+  uint16_t mv = batteryMillivolts();
+  if(mv && (!__logMillivolts || mv < __logMillivolts))
+    __logMillivolts = mv;
+
+  if(++__logSeconds < TELEMETRY_LOG_PERIOD)
+    return;
+
+  // If the last record is somehow still going out, this one waits for the next period.
+  if(!__stagedBytes)
+    stageTelemetryRecord(poweredOn);
+  startTelemetryPeriod();
+} // updateTelemetryLog()
+
+
+// Sequence number last, so a record cut short by a power loss is not taken for the newest one.
+boolean writeTelemetryLog(void) {
+  if(!__stagedBytes || !eeprom_is_ready())
+    return false;
+
+  uint8_t b = __stagedBytes - 1;
+  eeprom_update_byte(slotAddress(__logHead) + b, ((uint8_t *)&__staged)[b]);
+
+  if(--__stagedBytes == 0)
+  {
+    __logHead = (__logHead + 1) % TELEMETRY_RECORDS;
+    __logSequence = (__logSequence + 1) % TELEMETRY_SEQUENCE_MAX;
+  }
+  return true;
+} // writeTelemetryLog()
+
+
+boolean telemetryLogPending(void) {
+  return __stagedBytes != 0;
+} // telemetryLogPending()
+
+// End of file.
@@ -0,0 +1,52 @@
+#ifndef __SYNTHESIA_TELEMETRY_LOG_H
+#define __SYNTHESIA_TELEMETRY_LOG_H
+
+#include <Arduino.h>
+
+// Telemetry log in EEPROM.
+//
+// Every TELEMETRY_LOG_PERIOD seconds while the unit is on (or on USB), one 8 byte TelemetryRecord summing up the
+// period goes into a ring that fills the EEPROM above TELEMETRY_LOG_START. The ring itself is the wear levelling:
+// each record goes in the next slot, so every cell is written once per trip round the ring. At 5 minutes a record
+// that is once every 10 hours, and the EEPROM's 100,000 write cycles last far longer than the unit will.
+// The records are numbered, and the break in the numbering marks the newest, so no index needs to be stored.
+//
+// A record is staged in RAM and written a byte at a time by writeTelemetryLog(), which never waits on the EEPROM.
+// Writing it all at once would stall the frame for 27 ms.
+//
+// Send "dump" over USB serial to dump the log, oldest first, as "T <slot> <16 hex digits>" lines, then "T end".
+// The serial stream parser (serialStream.h) owns the serial input and passes the request on.
+// tools/telemetry_decode.py turns a dump into a table.
+
+#define TELEMETRY_LOG_START    64 // EEPROM below this is kept for settings
+#define TELEMETRY_LOG_END     1024
+#define TELEMETRY_LOG_PERIOD  300 // Seconds per record
+#define TELEMETRY_SEQUENCE_MAX 255 // Sequence numbers run 0-254. 0xFF is erased EEPROM.
+
+struct TelemetryRecord {
+  uint8_t sequence;
+  uint8_t mode;
+  uint8_t settings;       // Speed in the high nibble, brightness in the low
+  uint8_t battery;        // Lowest battery voltage in the period, in 20 mV steps
+  uint8_t fps;            // Average frames per second shown
+  uint8_t misses;         // Deadline misses in the period, saturating
+  uint8_t limiter;        // Lowest power limiter scale in the period. 255 if it never cut in.
+  uint8_t flags;          // TELEMETRY_* below, and the charge phase in the top 3 bits
+};
+
+#define TELEMETRY_POWERED  0x01 // Unit was on at the end of the period
+#define TELEMETRY_USB      0x02 // On USB power at the end of the period
+#define TELEMETRY_QUALITY  0x04 // Render quality dropped below full at some point
+
+#define TELEMETRY_RECORDS ((uint8_t)((TELEMETRY_LOG_END - TELEMETRY_LOG_START) / sizeof(TelemetryRecord)))
+
+void startTelemetryLog(void);                 // Finds the newest record. Call once from setup().
+void countTelemetryFrame(uint16_t scale);     // Call as each frame is shown, with the strip's output scale
+void updateTelemetryLog(boolean poweredOn);   // Call once a second
+boolean writeTelemetryLog(void);              // Polled. True if it wrote a byte.
+boolean telemetryLogPending(void);            // True while a record is still going out
+void dumpTelemetryLog(void);                  // To USB serial
+
+#endif
+
+// End of file.
@@ -0,0 +1,131 @@
+#include "timeBase.h"
+#include <avr/sleep.h>
+
+static volatile uint16_t      __timeBaseOverflows; // High word of the 4 us tick count
+static volatile unsigned long __timeBaseMillis;    // Whole milliseconds at the last overflow
+static volatile uint16_t      __timeBaseFraction;  // Microseconds past __timeBaseMillis at the last overflow
+static unsigned long          __sleepCycles;
+
+// Sleeps shorter than this are not worth it. Waking from IDLE takes a few cycles, but getting there does not.
+#define MIN_SLEEP_US 100
+
+
+void startTimeBase(void) {
+  uint8_t oldSREG = SREG;
+  cli();
+
+  TCCR1A = 0;
+  TCCR1B = (1 << CS11) | (1 << CS10); // Normal mode, /64
+  TCNT1  = 0;
+  TIFR1  = (1 << TOV1) | (1 << OCF1A);
+  TIMSK1 = (1 << TOIE1);
+
+  __timeBaseOverflows = 0;
+  __timeBaseMillis = 0;
+  __timeBaseFraction = 0;
+
+  SREG = oldSREG;
+} // startTimeBase()
+
+
+ISR(TIMER1_OVF_vect) {
+  // 65536 ticks of 4 us is 262 ms and 144 us.
+  __timeBaseOverflows++;
+  __timeBaseMillis += 262;
+  __timeBaseFraction += 144;
+  if(__timeBaseFraction >= 1000)
+  {
+    __timeBaseFraction -= 1000;
+    __timeBaseMillis++;
+  }
+} // ISR()
+
+
+// The alarm only has to wake the CPU. The interrupt is switched off again in sleepUntil().
+EMPTY_INTERRUPT(TIMER1_COMPA_vect);
+
+
+// Read TCNT1 and the overflow count as one value. An overflow that has happened but not yet been
+// serviced is counted in, the same way micros() handles Timer0.
+// Safe to call from an interrupt: the interrupt flag is saved and restored rather than turned back on.
+static uint16_t readTicks(uint16_t *overflows, unsigned long *millisBase, uint16_t *fraction) {
+  uint8_t oldSREG = SREG;
+  cli();
+
+  uint16_t ticks = TCNT1;
+  *overflows  = __timeBaseOverflows;
+  *millisBase = __timeBaseMillis;
+  *fraction   = __timeBaseFraction;
+  if((TIFR1 & (1 << TOV1)) && ticks < 0x8000)
+  {
+    (*overflows)++;
+    *millisBase += 262;
+    *fraction += 144;
+  }
+
+  SREG = oldSREG;
+  return ticks;
+} // readTicks()
+
+
+unsigned long timeMicros(void) {
+  uint16_t overflows, fraction;
+  unsigned long millisBase;
+  uint16_t ticks = readTicks(&overflows, &millisBase, &fraction);
+
+  // 65536 ticks is 2^18 us, so the two halves just shift into place.
+  return ((unsigned long)overflows << 18) | ((unsigned long)ticks << 2);
+} // timeMicros()
+
+
+unsigned long timeMillis(void) {
+  uint16_t overflows, fraction;
+  unsigned long millisBase;
+  uint16_t ticks = readTicks(&overflows, &millisBase, &fraction);
+
+  return millisBase + (fraction + ((unsigned long)ticks << 2)) / 1000;
+} // timeMillis()
+
+
+// Interrupts are off from the last look at pending() to the sleep instruction. An interrupt in that time is held
+// until sei(), and the AVR always runs the instruction after sei() first, so it wakes the CPU from the sleep
+// rather than being taken just before it and leaving the work it brought until the alarm.
+void sleepUntil(unsigned long wakeMicros, boolean (*pending)(void)) {
+  uint8_t oldSREG = SREG;
+  cli();
+
+  long remaining = (long)(wakeMicros - timeMicros());
+  if(remaining < MIN_SLEEP_US || (pending && pending()))
+  {
+    SREG = oldSREG;
+    return;
+  }
+
+  // The overflow interrupt wakes the CPU at least every 262 ms, so a longer wait just sleeps until then.
+  // The caller loops and sleeps again if it is still early.
+  if(remaining < 0x40000L)
+  {
+    OCR1A  = TCNT1 + (uint16_t)(remaining >> 2);
+    TIFR1  = (1 << OCF1A);
+    TIMSK1 |= (1 << OCIE1A);
+  }
+
+  // Keep the 1 ms tick from waking us. Any other interrupt (buttons, USB, the ADC) still does.
+  TIMSK0 &= ~(1 << TOIE0);
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_enable();
+  sei();
+  sleep_cpu();
+  sleep_disable();
+  TIMSK0 |= (1 << TOIE0);
+
+  TIMSK1 &= ~(1 << OCIE1A);
+  __sleepCycles++;
+} // sleepUntil()
+
+
+unsigned long sleepCycles(void) {
+  return __sleepCycles;
+} // sleepCycles()
+
+// End of file.
@@ -0,0 +1,28 @@
+#ifndef __SYNTHESIA_TIME_BASE_H
+#define __SYNTHESIA_TIME_BASE_H
+
+#include <Arduino.h>
+
+// The one clock everything is timed from: frame steps, task releases, the battery light and button debounce.
+//
+// Timer1 free runs at 16 MHz / 64, one count every 4 us, and overflows every 262.144 ms. The overflow
+// interrupt extends it to 32 bits. Compare match A is only used as an alarm to wake the CPU.
+// The Arduino 1 ms tick (Timer0) is switched off while asleep, so an idle CPU wakes up for the next deadline
+// rather than a thousand times a second. millis() and micros() therefore run slow; do not use them for timing.
+// delay() still works while awake.
+//
+// SLEEP_MODE_PWR_SAVE is not used between frames. The 32U4 has no asynchronous timer, so nothing could wake
+// it on time. IDLE already stops the CPU clock, which is where the current goes.
+
+#define TIME_BASE_US_PER_TICK 4
+
+void startTimeBase(void);
+unsigned long timeMicros(void);                // Wraps after about 71 minutes, like micros()
+unsigned long timeMillis(void);                // Wraps after about 49 days, like millis()
+void sleepUntil(unsigned long wakeMicros,      // Idle until timeMicros() reaches wakeMicros, or any interrupt.
+                boolean (*pending)(void));     // Checked with interrupts off; no sleep if it is true. May be 0.
+unsigned long sleepCycles(void);               // Times sleepUntil() has put the CPU to sleep. In the energy profile.
+
+#endif
+
+// End of file.
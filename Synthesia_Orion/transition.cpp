@@ -0,0 +1,122 @@
+#include "transition.h"
+#include "orion.h"
+#include "timeBase.h"
+
+static uint8_t       __transitionFrom[PIXEL_COUNT * 3]; // Last frame of the outgoing mode, raw strip bytes
+static boolean       __transitionActive = false;
+static uint8_t       __transitionStyle = TRANSITION_STYLES - 1;
+static unsigned long __transitionStart;     // timeMillis() when the mode changed
+static unsigned long __transitionLastShow;  // timeMicros() of the last frame sent
+static uint8_t       __transitionMix;       // Progress of the frame being sent, 0-255
+static uint8_t       __dissolveBits;        // Bits in the highest pixel index
+static uint16_t      __transitionFromSum;   // Channel sum of __transitionFrom
+
+// Pixels over which the wipe's leading edge fades in.
+#define WIPE_EDGE 4
+
+
+void beginTransition(LPD8806 &strip) {
+  memcpy(__transitionFrom, strip.getPixels(), sizeof(__transitionFrom));
+  __transitionFromSum = strip.getChannelSum();
+
+  if(++__transitionStyle >= TRANSITION_STYLES)
+    __transitionStyle = 0;
+
+  __dissolveBits = 0;
+  while((PIXEL_COUNT - 1) >> __dissolveBits)
+    __dissolveBits++;
+
+  __transitionStart = timeMillis();
+  __transitionLastShow = timeMicros();
+  __transitionActive = true;
+} // beginTransition()
+
+
+boolean transitionActive(void) {
+  return __transitionActive;
+} // transitionActive()
+
+
+uint16_t transitionChannelSum(void) {
+  return __transitionActive ? __transitionFromSum : 0;
+} // transitionChannelSum()
+
+
+boolean transitionDue(void) {
+  return __transitionActive && timeMicros() - __transitionLastShow >= TRANSITION_FRAME_US;
+} // transitionDue()
+
+
+unsigned long nextTransitionFrame(void) {
+  return __transitionLastShow + TRANSITION_FRAME_US;
+} // nextTransitionFrame()
+
+
+// The whole frame blends by the same amount. Eased in and out so the start and end do not jump.
+static uint8_t crossfadeMix(uint16_t n) {
+  uint16_t t = __transitionMix;
+  // 3t^2 - 2t^3, in 8-bit fixed point
+  uint16_t t2 = (t * t) >> 8;
+  return (t2 * (768 - 2 * t)) >> 8;
+} // crossfadeMix()
+
+
+// The incoming mode sweeps in from pixel 0 behind a soft edge.
+static uint8_t wipeMix(uint16_t n) {
+  // Leading edge in 8.8 fixed point pixels. It runs from WIPE_EDGE pixels before the strip to WIPE_EDGE past it,
+  // so the last pixel is fully in before the transition ends.
+  int32_t edge = (int32_t)(PIXEL_COUNT + 2 * WIPE_EDGE) * __transitionMix - ((int32_t)WIPE_EDGE << 8);
+  int32_t d = (edge - ((int32_t)n << 8)) / WIPE_EDGE;
+  return d <= 0 ? 0 : d >= 255 ? 255 : d;
+} // wipeMix()
+
+
+// Each pixel fades in over half the transition. The start times follow the bit reversed pixel index, the same
+// ordered dither sequence as dither(), so the new mode appears evenly across the whole strip at once.
+static uint8_t dissolveMix(uint16_t n) {
+  uint16_t reverse = 0;
+  for(uint8_t bit = 0; bit < __dissolveBits; bit++)
+  {
+    reverse = (reverse << 1) | (n & 1);
+    n >>= 1;
+  }
+  // Start time 0-255 across the first half, then 128 steps of fade.
+  int16_t d = 2 * (int16_t)__transitionMix - (int16_t)((reverse << 8) >> __dissolveBits);
+  return d <= 0 ? 0 : d >= 255 ? 255 : d;
+} // dissolveMix()
+
+
+void showTransition(LPD8806 &strip) {
+  if(!__transitionActive)
+  {
+    strip.show();
+    return;
+  }
+
+  unsigned long elapsed = timeMillis() - __transitionStart;
+  __transitionLastShow = timeMicros();
+
+  if(elapsed >= TRANSITION_MS)
+  {
+    __transitionActive = false;
+    strip.show();
+    return;
+  }
+
+  __transitionMix = (elapsed * 256) / TRANSITION_MS;
+
+  switch(__transitionStyle)
+  {
+    case TRANSITION_WIPE:
+      strip.showBlended(__transitionFrom, wipeMix);
+      break;
+    case TRANSITION_DISSOLVE:
+      strip.showBlended(__transitionFrom, dissolveMix);
+      break;
+    default:
+      strip.showBlended(__transitionFrom, crossfadeMix);
+      break;
+  }
+} // showTransition()
+
+// End of file.
@@ -0,0 +1,40 @@
+#ifndef __SYNTHESIA_TRANSITION_H
+#define __SYNTHESIA_TRANSITION_H
+
+#include <Arduino.h>
+#include "LPD8806.h"
+
+// Mode transitions. On a mode change the last frame of the outgoing mode is kept, and for TRANSITION_MS the
+// incoming mode is shown blended over it instead of cutting straight to it. The style rotates on every change:
+// crossfade, wipe, then an ordered dissolve that reveals pixels in the bit reversed order dither() uses.
+//
+// The blend happens as the frame is sent (LPD8806::showBlended()), so the incoming mode keeps its own pixel
+// buffer untouched and can go on drawing over its previous frame. All of it is 8-bit fixed point.
+// The strip bytes are PWM duty, which is already linear light, so blending them directly is the gamma correct blend.
+//
+// Cost: 3 bytes of SRAM per pixel for the outgoing frame (384 bytes at 128 pixels), and one 8x8 multiply per
+// channel while sending. Outgoing modes are not run on during the transition: both modes would need their state,
+// and the mode arena only ever holds one.
+
+#ifndef TRANSITION_MS
+#define TRANSITION_MS       600
+#endif
+#define TRANSITION_FRAME_US 20000UL // Frames are sent at least this often during a transition, even by slow modes
+
+enum {
+  TRANSITION_CROSSFADE,
+  TRANSITION_WIPE,
+  TRANSITION_DISSOLVE,
+  TRANSITION_STYLES
+};
+
+void beginTransition(LPD8806 &strip);     // Call just before the mode changes
+boolean transitionActive(void);
+boolean transitionDue(void);              // True if a transition frame should be sent even with no new frame drawn
+unsigned long nextTransitionFrame(void);  // timeMicros() by which the next transition frame is due
+void showTransition(LPD8806 &strip);      // strip.show() with the transition applied. Ends the transition when it is done.
+uint16_t transitionChannelSum(void);      // Channel sum of the outgoing frame while a transition runs, otherwise 0
+
+#endif
+
+// End of file.
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""Encode a frame capture into a flash animation for playback() (see animation.h).
+
+The capture is text, one frame per line, each pixel as six hex digits of 8 bit RGB:
+
+    ff0000 00ff00 0000ff ...
+
+Spaces between pixels are optional, and lines starting with # are skipped.
+
+    tools/animation_encode.py capture.txt --period 20 -o Synthesia_Orion/animationData.h
+    tools/animation_encode.py --demo comet --pixels 32 -o Synthesia_Orion/animationData.h
+    tools/animation_encode.py capture.txt --stats
+
+The encoder picks a key frame or an XOR delta for each frame, whichever is smaller, with a key frame at least
+every --keyframe frames if set. It decodes the result again to check it, then prints the compression ratio
+against raw frames and the worst frame, which bounds the decode time.
+"""
+
+import argparse
+import colorsys
+import math
+import sys
+
+VERSION = 1
+KEY = 1
+
+
+def read_capture(path):
+    frames = []
+    f = sys.stdin if path == "-" else open(path)
+    for line in f:
+        line = line.strip().replace(" ", "")
+        if not line or line.startswith("#"):
+            continue
+        if len(line) % 6:
+            sys.exit("frame %d: %d hex digits is not a whole number of pixels" % (len(frames) + 1, len(line)))
+        data = bytes.fromhex(line)
+        frames.append([tuple(data[i:i + 3]) for i in range(0, len(data), 3)])
+    if f is not sys.stdin:
+        f.close()
+    if not frames:
+        sys.exit("no frames in %s" % path)
+    if any(len(fr) != len(frames[0]) for fr in frames):
+        sys.exit("frames have different pixel counts")
+    return frames
+
+
+def demo(name, pixels, count):
+    """Looks that are easy to make here and awkward to draw procedurally on the AVR."""
+    frames = []
+    for t in range(count):
+        frame = []
+        for i in range(pixels):
+            if name == "comet":
+                head = t * pixels / float(count)
+                d = (head - i) % pixels
+                level = max(0.0, 1.0 - d / 8.0) ** 2
+                r, g, b = colorsys.hsv_to_rgb(t / float(count), 0.6, level)
+            else:  # "interference"
+                v = math.sin(i * 0.45 + t * 0.3) + math.sin(i * 0.17 - t * 0.21)
+                r, g, b = colorsys.hsv_to_rgb((v + 2) / 8.0 + t / float(count), 1.0, 0.5 + v / 4.0 if v > 0 else 0.0)
+            frame.append((int(r * 255), int(g * 255), int(b * 255)))
+        frames.append(frame)
+    return frames
+
+
+def strip_bytes(frame):
+    """8 bit RGB pixels to the LPD8806's 7 bit GRB bytes."""
+    out = []
+    for r, g, b in frame:
+        out += [g >> 1, r >> 1, b >> 1]
+    return out
+
+
+def encode_ops(values, skip_zero):
+    """Literal and repeat ops over values. Repeats of 3 or more pay for themselves, and so does any run of 0
+    in a delta, since the decoder skips those without writing."""
+    out = []
+    literal = []
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < 128 and values[i + run] == values[i]:
+            run += 1
+        if run >= 3 or (skip_zero and values[i] == 0 and run >= 2):
+            while literal:
+                chunk, literal = literal[:128], literal[128:]
+                out += [len(chunk) - 1] + chunk
+            out += [0x80 | (run - 1), values[i]]
+            i += run
+        else:
+            literal.append(values[i])
+            i += 1
+    while literal:
+        chunk, literal = literal[:128], literal[128:]
+        out += [len(chunk) - 1] + chunk
+    return out
+
+
+def encode(frames, period, keyframe):
+    pixels = len(frames[0])
+    data = [ord("O"), ord("A"), VERSION, pixels & 0xFF, pixels >> 8, len(frames) & 0xFF, len(frames) >> 8, period]
+    sizes = []
+    keys = 0
+    previous = None
+    since_key = 0
+    for n, frame in enumerate(frames):
+        values = strip_bytes(frame)
+        key = [KEY] + encode_ops(values, False)
+        if previous is None or (keyframe and since_key + 1 >= keyframe):
+            chosen = key
+        else:
+            delta = [0] + encode_ops([a ^ b for a, b in zip(values, previous)], True)
+            chosen = key if len(key) <= len(delta) else delta
+        if chosen[0] == KEY:
+            keys += 1
+            since_key = 0
+        else:
+            since_key += 1
+        data += chosen
+        sizes.append(len(chosen))
+        previous = values
+    # Playback loops from the last frame to the first, which is a key frame, so there is no wrap delta to store.
+    return data, sizes, keys
+
+
+def decode(data):
+    """The decoder in animation.cpp, to check the encoder against."""
+    pixels = data[3] | data[4] << 8
+    count = data[5] | data[6] << 8
+    total = pixels * 3
+    buf = [0] * total
+    frames = []
+    i = 8
+    for _ in range(count):
+        key = data[i] & KEY
+        i += 1
+        pos = 0
+        while pos < total:
+            op = data[i]
+            i += 1
+            n = (op & 0x7F) + 1
+            if op & 0x80:
+                vals = [data[i]] * n
+                i += 1
+            else:
+                vals = data[i:i + n]
+                i += n
+            for k, v in enumerate(vals):
+                buf[pos + k] = v if key else buf[pos + k] ^ v
+            pos += n
+        frames.append(list(buf))
+    return frames
+
+
+def write_header(path, data, name, source):
+    lines = ["// Generated by tools/animation_encode.py from %s. Do not edit." % source,
+             "// %d bytes. Played by playback(), see animation.h." % len(data),
+             "",
+             "#ifndef __SYNTHESIA_ANIMATION_DATA_H",
+             "#define __SYNTHESIA_ANIMATION_DATA_H",
+             "",
+             "PROGMEM prog_uchar %s[] = {" % name]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines += ["};", "", "#endif", "", "// End of file.", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("capture", nargs="?", help="capture file, or - for stdin")
+    parser.add_argument("--demo", choices=["comet", "interference"], help="encode a built in look instead")
+    parser.add_argument("--pixels", type=int, default=32, help="pixels for --demo")
+    parser.add_argument("--frames", type=int, default=64, help="frames for --demo")
+    parser.add_argument("--period", type=int, default=20, help="ms per frame, 1-255")
+    parser.add_argument("--keyframe", type=int, default=0, help="longest run of frames between key frames, 0 for no limit")
+    parser.add_argument("--name", default="__animation", help="name of the PROGMEM array")
+    parser.add_argument("-o", "--output", help="header file to write")
+    parser.add_argument("--stats", action="store_true", help="print sizes per frame as well")
+    args = parser.parse_args()
+
+    if args.demo:
+        frames = demo(args.demo, args.pixels, args.frames)
+        source = "--demo %s --pixels %d --frames %d" % (args.demo, args.pixels, args.frames)
+    elif args.capture:
+        frames = read_capture(args.capture)
+        source = args.capture
+    else:
+        parser.error("give a capture file or --demo")
+    if not 1 <= args.period <= 255:
+        parser.error("--period must be 1-255 ms")
+
+    data, sizes, keys = encode(frames, args.period, args.keyframe)
+    if decode(data) != [strip_bytes(f) for f in frames]:
+        sys.exit("internal error: the encoded animation does not decode to the capture")
+
+    raw = len(frames) * len(frames[0]) * 3
+    print("%d frames of %d pixels, %d key frames" % (len(frames), len(frames[0]), keys))
+    print("raw %d bytes, encoded %d bytes, ratio %.1f:1" % (raw, len(data), raw / float(len(data))))
+    print("frame bytes: average %.0f, worst %d (a raw frame is %d)"
+          % (sum(sizes) / float(len(sizes)), max(sizes), len(frames[0]) * 3))
+    if args.stats:
+        for n, size in enumerate(sizes):
+            print("  %4d %5d" % (n, size))
+
+    if args.output:
+        write_header(args.output, data, args.name, source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""Battery endurance per mode and setting, from an energy profile capture.
+
+Build the sketch with ENERGY_PROFILE set to 1 (see energyProfile.h), open the USB serial port and step through
+the modes, speeds and brightness levels with the buttons, a few seconds each:
+
+    cat /dev/ttyACM0 > capture.txt
+
+Then:
+
+    tools/energy_profile.py capture.txt
+    tools/energy_profile.py capture.txt --pixels 32,128 --brightness 1,0.6,0.3
+    tools/energy_profile.py after.txt --baseline before.txt
+
+Each capture line gives the strip's average channel sum and the CPU's busy time for one second. The strip current
+comes from the same model as powerLimiter.h (a fixed draw per pixel plus a draw per unit of channel value, capped
+at the power budget); the CPU draws MCU_ACTIVE_MA while busy and MCU_SLEEP_MA asleep. Channel sums are divided back
+to full brightness and per pixel, so the table can be given for any pixel count and any brightness, not just the
+five presets. Modes whose pattern depends on the pixel count (scanner, chases) scale only approximately.
+
+How often the CPU went to sleep, and the button press, power on latency, frame sync error, POV column timing
+and audio overrun lines in the capture are summed up after the table, with the battery gauge's last reading and
+the minutes it gave, and the most SRAM each mode was seen to use: its state, the shared arena and the least stack
+headroom left.
+"""
+
+import argparse
+import os
+import re
+import sys
+from collections import defaultdict
+
+SKETCH = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Synthesia_Orion")
+
+# Channel scale of each brightness preset, from colorAtBrightness() in orion.cpp.
+BRIGHTNESS_PRESETS = {1: 1.0, 2: 0.75, 3: 0.5, 4: 0.25, 5: 0.125}
+
+MCU_ACTIVE_MA = 20.0  # 32U4 at 16 MHz with USB, regulator and status light
+MCU_SLEEP_MA = 8.0    # Idle sleep between frames
+
+
+def header_define(name, path, default):
+    try:
+        with open(path) as f:
+            m = re.search(r"#define\s+%s\s+(\d+)" % name, f.read())
+        return int(m.group(1)) if m else default
+    except OSError:
+        return default
+
+
+def mode_names():
+    """Frame function of each mode, in mode button order, from the default list in modeList.h."""
+    try:
+        with open(os.path.join(SKETCH, "modeList.h")) as f:
+            return re.findall(r"^\s*MODE\((\w+),", f.read(), re.M)
+    except OSError:
+        return []
+
+
+def read_capture(path, latency=None, power_on=None, sync=None, pov=None, audio=None, battery=None, memory=None,
+                 sleeps=None):
+    """Average the capture lines per (mode, speed, brightness): full brightness channel sum per pixel, busy fraction.
+    Press latency lines are added to latency as [presses, total us, worst us], power on latencies to power_on,
+    sync error lines to sync as [beacons, total us, worst us, last trim ppm] and POV timing lines to pov as
+    [columns/s, columns, earliest, latest, longest column, late] in 0.5 us counts. Audio overrun lines are added
+    to audio as [seconds with drops, samples dropped], and the last battery line's [mV, charge %, minutes] goes
+    in battery. memory gets [state bytes, arena bytes, least stack headroom] per mode, and sleeps
+    [frames, sleeps, seconds]."""
+    totals = defaultdict(lambda: [0.0, 0.0, 0])
+    f = sys.stdin if path == "-" else open(path)
+    for line in f:
+        fields = line.split()
+        if latency is not None and len(fields) == 4 and fields[0] == "L":
+            presses, average, worst = (int(x) for x in fields[1:])
+            latency[0] += presses
+            latency[1] += presses * average
+            latency[2] = max(latency[2], worst)
+            continue
+        if power_on is not None and len(fields) == 2 and fields[0] == "P":
+            power_on.append(int(fields[1]))
+            continue
+        if sync is not None and len(fields) == 5 and fields[0] == "S":
+            beacons, average, worst, trim = (int(x) for x in fields[1:])
+            sync[0] += beacons
+            sync[1] += beacons * average
+            sync[2] = max(sync[2], worst)
+            sync[3] = trim
+            continue
+        if pov is not None and len(fields) == 7 and fields[0] == "C":
+            rate, columns, earliest, latest, length, late = (int(x) for x in fields[1:])
+            pov[0] = rate
+            pov[2] = earliest if not pov[1] else min(pov[2], earliest)
+            pov[1] += columns
+            pov[3] = max(pov[3], latest)
+            pov[4] = max(pov[4], length)
+            pov[5] += late
+            continue
+        if audio is not None and len(fields) == 2 and fields[0] == "A":
+            audio[0] += 1
+            audio[1] += int(fields[1])
+            continue
+        if battery is not None and len(fields) == 4 and fields[0] == "B":
+            battery[:] = [int(x) for x in fields[1:]]
+            continue
+        if memory is not None and len(fields) == 5 and fields[0] == "M":
+            mode, state, arena, headroom = (int(x) for x in fields[1:])
+            if mode in memory:
+                headroom = min(headroom, memory[mode][2])
+            memory[mode] = [state, arena, headroom]
+            continue
+        if len(fields) not in (8, 9) or fields[0] != "E":
+            continue
+        # Older captures have no sleep count.
+        mode, speed, level, pixels, channel_sum, busy, frames = (int(x) for x in fields[1:8])
+        if sleeps is not None and len(fields) == 9:
+            sleeps[0] += frames
+            sleeps[1] += int(fields[8])
+            sleeps[2] += 1
+        if frames == 0 or pixels == 0 or level not in BRIGHTNESS_PRESETS:
+            continue
+        t = totals[(mode, speed)]
+        t[0] += channel_sum / float(pixels) / BRIGHTNESS_PRESETS[level]
+        t[1] += busy / 100.0
+        t[2] += 1
+    if f is not sys.stdin:
+        f.close()
+    return dict((k, (v[0] / v[2], v[1] / v[2])) for k, v in totals.items())
+
+
+def current_ma(units_per_pixel, busy, pixels, brightness, model):
+    idle = pixels * model["idle_ua"] / 1000.0
+    drive = pixels * units_per_pixel * brightness * model["unit_ua"] / 1000.0
+    strip = min(idle + drive, max(idle, model["budget_ma"]))
+    return strip + busy * model["mcu_active_ma"] + (1 - busy) * model["mcu_sleep_ma"]
+
+
+def main():
+    limiter = os.path.join(SKETCH, "powerLimiter.h")
+    battery = os.path.join(SKETCH, "batteryStatus.h")
+
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("capture", help="capture file, or - for stdin")
+    parser.add_argument("--baseline", help="earlier capture to compare battery life against")
+    parser.add_argument("--pixels", default="32,64,96,128", help="pixel counts to predict for")
+    parser.add_argument("--brightness", default=None,
+                        help="brightness fractions to predict for (default: the five presets)")
+    parser.add_argument("--capacity", type=float, default=header_define("BATTERY_CAPACITY_MAH", battery, 2200),
+                        help="battery capacity in mAh")
+    parser.add_argument("--budget", type=float, default=header_define("POWER_BUDGET_MA", limiter, 1500),
+                        help="strip power budget in mA")
+    parser.add_argument("--mcu-active", type=float, default=MCU_ACTIVE_MA, help="mA with the CPU running")
+    parser.add_argument("--mcu-sleep", type=float, default=MCU_SLEEP_MA, help="mA with the CPU asleep")
+    args = parser.parse_args()
+
+    model = {
+        "idle_ua": header_define("STRIP_IDLE_UA_PER_PIXEL", limiter, 1000),
+        "unit_ua": header_define("STRIP_UA_PER_UNIT", limiter, 38),
+        "budget_ma": args.budget,
+        "mcu_active_ma": args.mcu_active,
+        "mcu_sleep_ma": args.mcu_sleep,
+    }
+    pixel_counts = [int(x) for x in args.pixels.split(",")]
+    if args.brightness:
+        levels = [(x, float(x)) for x in args.brightness.split(",")]
+    else:
+        levels = [(str(k), v) for k, v in sorted(BRIGHTNESS_PRESETS.items())]
+
+    latency = [0, 0, 0]
+    power_on = []
+    sync = [0, 0, 0, 0]
+    pov = [0, 0, 0, 0, 0, 0]
+    audio = [0, 0]
+    battery = []
+    memory = {}
+    sleeps = [0, 0, 0]
+    profile = read_capture(args.capture, latency, power_on, sync, pov, audio, battery, memory, sleeps)
+    baseline = read_capture(args.baseline) if args.baseline else {}
+    if not profile:
+        sys.exit("no energy profile lines in %s" % args.capture)
+
+    names = mode_names()
+    columns = ["mode", "speed", "bright"]
+    for n in pixel_counts:
+        columns += ["%dpx mA" % n, "%dpx h" % n]
+        if baseline:
+            columns.append("%dpx dh" % n)
+    print("\t".join(columns))
+
+    for (mode, speed) in sorted(profile):
+        name = names[mode] if mode < len(names) else str(mode)
+        units, busy = profile[(mode, speed)]
+        for label, brightness in levels:
+            row = [name, str(speed), label]
+            for n in pixel_counts:
+                ma = current_ma(units, busy, n, brightness, model)
+                hours = args.capacity / ma
+                row += ["%.0f" % ma, "%.1f" % hours]
+                if baseline:
+                    if (mode, speed) in baseline:
+                        old = current_ma(*baseline[(mode, speed)], pixels=n, brightness=brightness, model=model)
+                        row.append("%+.1f" % (hours - args.capacity / old))
+                    else:
+                        row.append("-")
+            print("\t".join(row))
+
+    if sleeps[2]:
+        print("\nCPU slept %.0f times a second, %.2f times a frame shown"
+              % (sleeps[1] / float(sleeps[2]), sleeps[1] / float(max(sleeps[0], 1))))
+    if latency[0]:
+        print("\nbutton presses %d, latency average %.1f ms, worst %.1f ms"
+              % (latency[0], latency[1] / 1000.0 / latency[0], latency[2] / 1000.0))
+    if power_on:
+        print("power on to first frame: %s ms" % ", ".join("%.1f" % (us / 1000.0) for us in power_on))
+    if sync[0]:
+        print("sync beacons %d, phase error average %d us, worst %d us, trim %+d ppm"
+              % (sync[0], sync[1] // sync[0], sync[2], sync[3]))
+    if pov[1]:
+        print("pov %d columns/s, %d columns, start jitter %.1f us (latency %.1f-%.1f us), longest column %.1f us, %d late"
+              % (pov[0], pov[1], (pov[3] - pov[2]) / 2.0, pov[2] / 2.0, pov[3] / 2.0, pov[4] / 2.0, pov[5]))
+    if audio[0]:
+        print("audio samples dropped %d, in %d seconds" % (audio[1], audio[0]))
+    if memory:
+        print("\nmode\tstate B\tarena B\tstack headroom B")
+        for mode in sorted(memory):
+            print("%s\t%d\t%d\t%d" % tuple([names[mode] if mode < len(names) else str(mode)] + memory[mode]))
+    if battery:
+        millivolts, percent, minutes = battery
+        print("battery at the end %d mV, %d%%, %s" % (millivolts, percent, "on USB" if minutes == 0xFFFF else
+                                                      "%d min remaining at the draw then" % minutes))
+
+
+if __name__ == "__main__":
+    main()
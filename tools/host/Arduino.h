@@ -0,0 +1,76 @@
+#ifndef __SYNTHESIA_HOST_ARDUINO_H
+#define __SYNTHESIA_HOST_ARDUINO_H
+
+// Desktop stand-in for the Arduino core, for the host checks (see tools/host_checks.py).
+//
+// Just enough for the sketch's hardware free modules to build unchanged with g++: the core's types and macros,
+// PROGMEM as plain memory, and the registers they touch as plain variables (host.cpp) that a check can set
+// and read. Interrupts never happen, so cli() and sei() do nothing. A check calls an ISR, or a handler given to
+// attachInterrupt(), itself at the moment the interrupt would have come.
+//
+// Serial and Serial1 are file descriptors: a socket or pty the check sets up in place of the cable. Nothing
+// comes in until the check calls receive(), as the UART or USB interrupt would have taken it, and then only as
+// much as the 64 byte buffer has room for; the rest waits in the descriptor. Writes go to every descriptor in tx,
+// as one TX pin can drive several RX pins.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+
+typedef uint8_t boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW  0
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+
+#define B00000001 1
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+int analogRead(uint8_t pin);
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(void), int mode);
+void detachInterrupt(uint8_t interrupt);
+extern void (*hostInterruptHandler[4])(void); // INT0-INT3, as attachInterrupt() left them
+
+#define SERIAL_BUFFER_SIZE 64
+#define HOST_SERIAL_TX      8
+
+class HardwareSerial {
+public:
+  HardwareSerial();
+  void begin(unsigned long baud) {}
+  void end(void) {}
+  int available(void);
+  int peek(void);
+  int read(void);
+  void flush(void) {}
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  operator bool() { return true; }
+
+  // For the checks.
+  int receive(void);              // Take what has arrived on rx into the buffer. Returns the bytes taken.
+  int rx;                         // Descriptor read by receive(), or -1
+  int tx[HOST_SERIAL_TX];         // Descriptors written to, -1 for none
+
+private:
+  uint8_t buffer[SERIAL_BUFFER_SIZE];
+  uint8_t head, tail;
+};
+
+extern HardwareSerial Serial, Serial1;
+
+#endif
+
+// End of file.
@@ -0,0 +1,19 @@
+#ifndef __SYNTHESIA_HOST_SPI_H
+#define __SYNTHESIA_HOST_SPI_H
+
+// Declarations only, for headers that name the SPI library. No host check drives the strip.
+
+#include <Arduino.h>
+
+class SPIClass {
+ public:
+  static void begin(void);
+  static void end(void);
+  static void setClockDivider(uint8_t divider);
+};
+
+extern SPIClass SPI;
+
+#endif
+
+// End of file.
@@ -0,0 +1,245 @@
+#include <stdio.h>
+#include <math.h>
+#include "audioAnalysis.h"
+#include "audioSampler.h"
+
+// Feed WAV recordings through the audio analysis exactly as the unit would hear them, and check the FFT
+// against a floating point DFT. Run by tools/host_checks.py, which makes test vectors with known beats.
+//
+//   audio_wav [options] file.wav ...
+//     --trace            print every block: time, level, bands, beat pulse
+//     --gain G           WAV full scale is G x half the ADC's range (default 1)
+//     --drop-every S     every S seconds, drop samples as an overrun of the ring would...
+//     --drop N           ...N of them (default 40), with the next block marked as having a gap
+//
+// The sampler is modelled from audioSampler.h: 10-bit conversions at 16 MHz / 128 / 13 around a mid scale bias,
+// summed in fours. For each file it prints the beats it found as "beats at <seconds> ...".
+
+#define CONVERSION_HZ (16000000.0 / 128 / 13)
+#define SAMPLE_HZ     (CONVERSION_HZ / AUDIO_DECIMATION)
+
+static double   __gain = 1.0;
+static double   __dropEvery = 0;
+static int      __drop = 40;
+static boolean  __trace = false;
+
+
+static uint32_t readLe(const unsigned char *p, int bytes) {
+  uint32_t v = 0;
+  for(int i = bytes - 1; i >= 0; i--)
+    v = (v << 8) | p[i];
+  return v;
+} // readLe()
+
+
+// PCM WAV, 8 to 32 bit, any rate and channel count, mixed to mono in -1 to 1. False if it is not one.
+static boolean readWav(const char *path, double **samples, long *count, double *rate) {
+  FILE *f = fopen(path, "rb");
+  if(!f)
+    return false;
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  unsigned char *data = (unsigned char *)malloc(size);
+  boolean ok = fread(data, 1, size, f) == (size_t)size;
+  fclose(f);
+  if(!ok || size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4))
+  {
+    free(data);
+    return false;
+  }
+
+  int channels = 0, bits = 0, format = 0;
+  long at = 12;
+  while(at + 8 <= size)
+  {
+    long chunk = readLe(data + at + 4, 4);
+    const unsigned char *body = data + at + 8;
+    if(!memcmp(data + at, "fmt ", 4) && chunk >= 16)
+    {
+      format = readLe(body, 2);
+      channels = readLe(body + 2, 2);
+      *rate = readLe(body + 4, 4);
+      bits = readLe(body + 14, 2);
+    } else if(!memcmp(data + at, "data", 4) && channels && (format == 1 || format == 0xFFFE)) {
+      int bytes = bits / 8;
+      if(at + 8 + chunk > size)
+        chunk = size - at - 8;
+      *count = chunk / (bytes * channels);
+      *samples = (double *)malloc(sizeof(double) * (*count > 0 ? *count : 1));
+      for(long i = 0; i < *count; i++)
+      {
+        double mix = 0;
+        for(int c = 0; c < channels; c++)
+        {
+          uint32_t raw = readLe(body + (i * channels + c) * bytes, bytes);
+          double v;
+          if(bytes == 1)
+            v = ((int)raw - 128) / 128.0;
+          else
+            v = (int32_t)(raw << (32 - bits)) / 2147483648.0;
+          mix += v;
+        }
+        (*samples)[i] = mix / channels;
+      }
+      free(data);
+      return true;
+    }
+    at += 8 + chunk + (chunk & 1);
+  }
+  free(data);
+  return false;
+} // readWav()
+
+
+// One 10-bit conversion of the microphone at time t: linear interpolation between the recording's samples,
+// biased to mid scale and clipped to the ADC's range.
+static int conversion(const double *wav, long count, double rate, double t) {
+  double at = t * rate;
+  long i = (long)at;
+  double v = 0;
+  if(i + 1 < count)
+    v = wav[i] + (wav[i + 1] - wav[i]) * (at - i);
+  int adc = (int)floor(512 + v * 511 * __gain + 0.5);
+  return adc < 0 ? 0 : adc > 1023 ? 1023 : adc;
+} // conversion()
+
+
+static void analyse(const char *path) {
+  double *wav = 0;
+  long count = 0;
+  double rate = 0;
+  if(!readWav(path, &wav, &count, &rate) || rate <= 0)
+  {
+    printf("%s: not a PCM WAV file\n", path);
+    exit(2);
+  }
+
+  resetAudioAnalysis();
+  int16_t block[AUDIO_BLOCK_SIZE];
+  int filled = 0;
+  long blocks = 0, beats = 0, gaps = 0;
+  double levelSum = 0, bandSum[AUDIO_BANDS] = { 0 };
+  double seconds = count / rate;
+  long samples = (long)(seconds * SAMPLE_HZ);
+  double nextDrop = __dropEvery;
+  boolean gap = false;
+  printf("%s: %.2f s at %.0f Hz\n", path, seconds, rate);
+  printf("beats at");
+
+  for(long n = 0; n < samples; n++)
+  {
+    double t = n / SAMPLE_HZ;
+    if(__dropEvery > 0 && t >= nextDrop)
+    {
+      // The ring was full for this long: the samples never reach a block.
+      n += __drop - 1;
+      nextDrop += __dropEvery;
+      gap = true;
+      gaps++;
+      continue;
+    }
+
+    int sum = 0;
+    for(int c = 0; c < AUDIO_DECIMATION; c++)
+      sum += conversion(wav, count, rate, t + c / CONVERSION_HZ);
+    block[filled++] = sum;
+    if(filled < AUDIO_BLOCK_SIZE)
+      continue;
+
+    filled = 0;
+    audioBeat = false;
+    processAudioBlock(block, gap);
+    gap = false;
+    blocks++;
+    levelSum += audioLevel;
+    for(int b = 0; b < AUDIO_BANDS; b++)
+      bandSum[b] += audioBands[b];
+    // The block ends at t. A beat is reported at the block's start, which is as early as it can be known.
+    double start = t - (AUDIO_BLOCK_SIZE - 1) / SAMPLE_HZ;
+    if(audioBeat)
+    {
+      beats++;
+      if(!__trace)
+        printf(" %.3f", start);
+    }
+    if(__trace)
+      printf("\n  %8.3f  level %3d  bands %3d %3d %3d %3d  pulse %3d%s", start, audioLevel, audioBands[0],
+             audioBands[1], audioBands[2], audioBands[3], audioBeatPulse, audioBeat ? "  BEAT" : "");
+  }
+  printf("\n");
+  printf("%ld blocks, %ld beats, %ld gaps, level average %.0f, bands average", blocks, beats, gaps,
+         blocks ? levelSum / blocks : 0);
+  for(int b = 0; b < AUDIO_BANDS; b++)
+    printf(" %.0f", blocks ? bandSum[b] / blocks : 0);
+  printf("\n");
+  free(wav);
+} // analyse()
+
+
+// fft32() returns the spectrum over 32. Every bin of random blocks, and of a pure tone in each bin, against a
+// double precision DFT. The stage by stage halving truncates, so a few counts of error are expected.
+static boolean checkFft(void) {
+  int worst = 0;
+  boolean peaks = true;
+  srand(1);
+  for(int trial = 0; trial < 1000 + 15; trial++)
+  {
+    int16_t re[32], im[32];
+    double x[32];
+    int tone = trial >= 1000 ? trial - 1000 + 1 : 0;
+    for(int i = 0; i < 32; i++)
+    {
+      x[i] = tone ? floor(16000 * cos(2 * M_PI * tone * i / 32) + 0.5) : (rand() % 32768) - 16384;
+      re[i] = (int16_t)x[i];
+      im[i] = 0;
+    }
+    fft32(re, im);
+
+    int peak = 1;
+    for(int k = 0; k < 32; k++)
+    {
+      double dr = 0, di = 0;
+      for(int i = 0; i < 32; i++)
+      {
+        dr += x[i] * cos(2 * M_PI * k * i / 32);
+        di -= x[i] * sin(2 * M_PI * k * i / 32);
+      }
+      int error = (int)ceil(fmax(fabs(dr / 32 - re[k]), fabs(di / 32 - im[k])));
+      if(error > worst)
+        worst = error;
+      if(k >= 1 && k < 16 && abs(re[k]) + abs(im[k]) > abs(re[peak]) + abs(im[peak]))
+        peak = k;
+    }
+    if(tone && peak != tone)
+      peaks = false;
+  }
+  boolean ok = worst <= 8 && peaks;
+  printf("fft32: worst error %d counts of the spectrum over 32 (limit 8), tones peak in their own bin: %s%s\n",
+         worst, peaks ? "yes" : "NO", ok ? "" : "  FAIL");
+  return ok;
+} // checkFft()
+
+
+int main(int argc, char **argv) {
+  boolean ok = checkFft();
+
+  for(int i = 1; i < argc; i++)
+  {
+    if(!strcmp(argv[i], "--trace"))
+      __trace = true;
+    else if(!strcmp(argv[i], "--gain") && i + 1 < argc)
+      __gain = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--drop-every") && i + 1 < argc)
+      __dropEvery = atof(argv[++i]);
+    else if(!strcmp(argv[i], "--drop") && i + 1 < argc)
+      __drop = atoi(argv[++i]);
+    else if(!strcmp(argv[i], "--no-bench"))
+      continue;
+    else
+      analyse(argv[i]);
+  }
+  return ok ? 0 : 1;
+} // main()
+
+// End of file.
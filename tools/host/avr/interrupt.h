@@ -0,0 +1,12 @@
+#ifndef __SYNTHESIA_HOST_AVR_INTERRUPT_H
+#define __SYNTHESIA_HOST_AVR_INTERRUPT_H
+
+// Nothing interrupts a host check. An ISR is an ordinary function a check can call to stand in for the interrupt.
+
+#define ISR(vector) extern "C" void vector(void); void vector(void)
+#define cli()
+#define sei()
+
+#endif
+
+// End of file.
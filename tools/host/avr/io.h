@@ -0,0 +1,32 @@
+#ifndef __SYNTHESIA_HOST_AVR_IO_H
+#define __SYNTHESIA_HOST_AVR_IO_H
+
+// The registers the host checks' modules touch, as plain variables defined in host.cpp. Bit numbers are the
+// 32U4's.
+
+#include <stdint.h>
+
+#define HOST_REGISTERS(R) \
+  R(PINB)  R(PORTB) R(DDRB) \
+  R(PINC)  R(PORTC) R(DDRC) \
+  R(PIND)  R(PORTD) R(DDRD) \
+  R(PINE)  R(PORTE) R(DDRE) \
+  R(PINF)  R(PORTF) R(DDRF) \
+  R(PCICR) R(PCIFR) R(PCMSK0) \
+  R(EIMSK) R(EIFR) \
+  R(UDINT) R(SREG)
+
+#define HOST_DECLARE_REGISTER(name) extern volatile uint8_t name;
+HOST_REGISTERS(HOST_DECLARE_REGISTER)
+#undef HOST_DECLARE_REGISTER
+
+#define PCINT0 0
+#define PCINT6 6
+#define PCIE0  0
+#define PCIF0  0
+#define INT2   2
+#define INTF2  2
+
+#endif
+
+// End of file.
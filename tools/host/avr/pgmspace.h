@@ -0,0 +1,19 @@
+#ifndef __SYNTHESIA_HOST_AVR_PGMSPACE_H
+#define __SYNTHESIA_HOST_AVR_PGMSPACE_H
+
+// On the host, flash is just memory.
+
+#include <stdint.h>
+
+#define PROGMEM
+
+typedef unsigned char prog_uchar;
+typedef int16_t       prog_int16_t;
+typedef uint16_t      prog_uint16_t;
+
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+
+#endif
+
+// End of file.
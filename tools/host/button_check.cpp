@@ -0,0 +1,272 @@
+#include <stdio.h>
+#include "buttonEvents.h"
+#include "pins.h"
+
+// Bouncy presses through the button path as the unit runs it: the pin change ISR queues the falling edges,
+// and nextButtonEvent() hands them and the held button polls to updateButtonState(). Run by tools/host_checks.py.
+//
+// Each press is a pin waveform with contact bounce on the way down and up. The main loop is modelled as waking
+// 20 us after each edge and every BUTTON_POLL_MS while a button is active, as the input task does.
+//
+// unsigned long is 64 bits here, so the 71 minute wrap of timeMicros() is not exercised.
+
+extern "C" void PCINT0_vect(void); // buttonEvents.cpp
+
+static unsigned long __now;
+
+unsigned long timeMicros(void) {
+  return __now;
+} // timeMicros()
+
+
+void wakeTasks(void) {
+} // wakeTasks()
+
+
+#define MS 1000UL
+#define LOOP_LATENCY_US 20
+
+struct Transition {
+  unsigned long time;
+  boolean       down;
+};
+
+struct Event {
+  uint8_t       kind;
+  unsigned long time;
+};
+
+static Transition __wave[32768];
+static int        __waveCount;
+static Event      __events[1024];
+static int        __eventCount;
+static int        __failures;
+static uint32_t   __seed = 1;
+
+
+static unsigned long randomBetween(unsigned long low, unsigned long high) {
+  __seed = __seed * 1103515245UL + 12345;
+  return low + (__seed >> 8) % (high - low + 1);
+} // randomBetween()
+
+
+static void addTransition(unsigned long time, boolean down) {
+  __wave[__waveCount].time = time;
+  __wave[__waveCount].down = down;
+  __waveCount++;
+} // addTransition()
+
+
+// The contact makes and breaks at random for bounce us, then settles to down.
+static void addBounce(unsigned long start, unsigned long bounce, boolean down) {
+  unsigned long t = start;
+  boolean level = down;
+  while(t - start < bounce)
+  {
+    addTransition(t, level);
+    t += randomBetween(50, 800);
+    level = !level;
+  }
+  if(level == down)
+    addTransition(t, down);
+} // addBounce()
+
+
+// A press from start for length, the first edge at start. Returns the time of the last edge.
+static unsigned long addPress(unsigned long start, unsigned long length, unsigned long bounceDown,
+                              unsigned long bounceUp) {
+  addBounce(start, bounceDown, true);
+  addBounce(start + length, bounceUp, false);
+  return __wave[__waveCount - 1].time;
+} // addPress()
+
+
+static void drain(void) {
+  ButtonEvent event;
+  while(nextButtonEvent(&event))
+  {
+    if(event.button != BUTTON_MODE || __eventCount == (int)(sizeof(__events) / sizeof(__events[0])))
+      continue;
+    __events[__eventCount].kind = event.kind;
+    __events[__eventCount].time = event.time;
+    __eventCount++;
+  }
+} // drain()
+
+
+// Play the waveform on the mode button's pin.
+static void run(void) {
+  __eventCount = 0;
+  unsigned long poll = 0;
+  boolean polling = false;
+  for(int i = 0; i < __waveCount || buttonsActive(); )
+  {
+    if(polling && (i == __waveCount || (long)(poll - __wave[i].time) <= 0))
+    {
+      __now = poll;
+      drain();
+      poll += BUTTON_POLL_MS * MS;
+      polling = buttonsActive();
+      continue;
+    }
+    if(i == __waveCount)
+    {
+      // Nothing more to come and the press still followed: it has to end on a poll.
+      poll = __now + BUTTON_POLL_MS * MS;
+      polling = true;
+      continue;
+    }
+
+    __now = __wave[i].time;
+    if(__wave[i].down)
+      PINB &= ~BUTTON_MODE_PCINT_MASK;
+    else
+      PINB |= BUTTON_MODE_PCINT_MASK;
+    PCINT0_vect();
+    i++;
+
+    // Busy with the ISRs if the next edge comes first.
+    if(i < __waveCount && __wave[i].time - __now < LOOP_LATENCY_US)
+      continue;
+    __now += LOOP_LATENCY_US;
+    drain();
+    poll = __now + BUTTON_POLL_MS * MS;
+    polling = buttonsActive();
+  }
+  __waveCount = 0;
+} // run()
+
+
+static int countEvents(uint8_t kind) {
+  int n = 0;
+  for(int i = 0; i < __eventCount; i++)
+    n += __events[i].kind == kind;
+  return n;
+} // countEvents()
+
+
+static void check(const char *what, boolean ok) {
+  printf("  %-64s %s\n", what, ok ? "ok" : "FAIL");
+  if(!ok)
+  {
+    for(int i = 0; i < __eventCount; i++)
+      printf("      %s at %lu us\n", __events[i].kind == BUTTON_PRESS ? "press" : __events[i].kind == BUTTON_LONG ?
+             "long" : "repeat", __events[i].time);
+    __failures++;
+  }
+} // check()
+
+
+static unsigned long __start = 1000 * MS;
+
+static void checkTaps(void) {
+  addPress(__start, 100 * MS, 0, 0);
+  run();
+  check("clean tap: one press", __eventCount == 1 && countEvents(BUTTON_PRESS) == 1);
+
+  addPress(__start, 100 * MS, 5 * MS, 5 * MS);
+  run();
+  check("tap with 5 ms of bounce each way: one press, at the first edge",
+        __eventCount == 1 && countEvents(BUTTON_PRESS) == 1 && __events[0].time == __start);
+
+  addPress(__start, 60 * MS, 2 * MS, 15 * MS);
+  run();
+  check("15 ms of bounce on release: no second press", __eventCount == 1);
+
+  // The release bounce ends well short of BUTTON_RELEASE_MS before the next press.
+  unsigned long end = addPress(__start, 70 * MS, 3 * MS, 3 * MS);
+  addPress(end + 40 * MS, 70 * MS, 3 * MS, 3 * MS);
+  run();
+  check("second press 40 ms after the first let go: two presses", countEvents(BUTTON_PRESS) == 2);
+
+  end = addPress(__start, 70 * MS, 3 * MS, 3 * MS);
+  addPress(end + 10 * MS, 70 * MS, 0, 0);
+  run();
+  check("edge 10 ms after a release: still bounce, one press", countEvents(BUTTON_PRESS) == 1);
+} // checkTaps()
+
+
+static void checkHolds(void) {
+  addPress(__start, 1500 * MS, 8 * MS, 8 * MS);
+  run();
+  boolean ok = __eventCount == 6 && __events[0].kind == BUTTON_PRESS && __events[1].kind == BUTTON_LONG;
+  if(ok)
+  {
+    unsigned long longAt = __events[1].time - __start;
+    ok = longAt >= BUTTON_LONG_MS * MS && longAt <= (BUTTON_LONG_MS + BUTTON_POLL_MS) * MS;
+    for(int i = 2; i < __eventCount && ok; i++)
+    {
+      unsigned long due = __events[1].time + (i - 1) * BUTTON_REPEAT_MS * MS;
+      ok = __events[i].kind == BUTTON_REPEAT && __events[i].time >= due &&
+           __events[i].time <= due + BUTTON_POLL_MS * MS;
+    }
+  }
+  check("1.5 s hold: press, long at 600 ms, a repeat every 200 ms", ok);
+
+  addPress(__start, BUTTON_LONG_MS * MS - 20 * MS, 4 * MS, 4 * MS);
+  run();
+  check("let go 20 ms short of a long press: just the press", __eventCount == 1);
+
+  // A glitch landing after the long press is due but before the poll that would report it.
+  addTransition(__start, true);
+  addTransition(__start + BUTTON_LONG_MS * MS + 5, false);
+  addTransition(__start + BUTTON_LONG_MS * MS + 10, true);
+  addTransition(__start + 1000 * MS, false);
+  run();
+  check("glitch just as the long press falls due: the long press kept", countEvents(BUTTON_LONG) == 1);
+
+  // Once held, a break looks just like the bounce of letting go, so it is only tried before the long press.
+  addTransition(__start, true);
+  for(unsigned long t = 100; t < BUTTON_LONG_MS; t += 100)
+  {
+    addTransition(__start + t * MS, false);
+    addTransition(__start + t * MS + 300, true);
+  }
+  addTransition(__start + 700 * MS, false);
+  run();
+  check("chatter while held down: one press, one long", countEvents(BUTTON_PRESS) == 1 &&
+        countEvents(BUTTON_LONG) == 1);
+
+  unsigned long end = addPress(__start, 900 * MS, 3 * MS, 12 * MS);
+  addPress(end + 50 * MS, 100 * MS, 3 * MS, 3 * MS);
+  run();
+  check("tap after a hold with a bouncy release: two presses, one long", countEvents(BUTTON_PRESS) == 2 &&
+        countEvents(BUTTON_LONG) == 1);
+} // checkHolds()
+
+
+// Many presses of random length, bounce and spacing. Lengths within a poll of the long press time could go
+// either way, so they are left out.
+static void checkRandom(void) {
+  int presses = 0, longs = 0;
+  unsigned long t = __start;
+  for(int i = 0; i < 400; i++)
+  {
+    unsigned long length = randomBetween(40, 1100);
+    if(length >= BUTTON_LONG_MS - 1 && length <= BUTTON_LONG_MS + BUTTON_POLL_MS + 10)
+      length = 300;
+    unsigned long end = addPress(t, length * MS, randomBetween(0, 8 * MS), randomBetween(0, 8 * MS));
+    t = end + randomBetween(BUTTON_RELEASE_MS + 15, 400) * MS;
+    presses++;
+    longs += length > BUTTON_LONG_MS;
+  }
+  run();
+  char what[64];
+  snprintf(what, sizeof(what), "%d random bouncy presses, %d long: each seen once", presses, longs);
+  check(what, countEvents(BUTTON_PRESS) == presses && countEvents(BUTTON_LONG) == longs);
+} // checkRandom()
+
+
+int main(int argc, char **argv) {
+  PINB = BUTTON_MODE_PCINT_MASK | BUTTON_SPEED_PCINT_MASK;
+  printf("buttons: release %d ms, long %d ms, repeat %d ms, polled every %d ms\n", BUTTON_RELEASE_MS,
+         BUTTON_LONG_MS, BUTTON_REPEAT_MS, BUTTON_POLL_MS);
+  checkTaps();
+  checkHolds();
+  checkRandom();
+
+  printf("%s\n", __failures ? "FAILED" : "passed");
+  return __failures ? 1 : 0;
+} // main()
+
+// End of file.
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include "chargeControl.h"
+
+// A simulated battery and USB cable driving updateChargeState() through attach, detach, charge to full, load and
+// sag. Run by tools/host_checks.py.
+//
+// One step is one battery update, 232 ms. The cell is CHARGE_CAPACITY_MAH, charged at 450 mA or CHARGE_FAST_MA
+// until the charger's constant voltage stage tapers the current off above 90%. The gauge reads the charge through
+// the cell voltage, so it reads high while charging, low under a strip load the sag compensation does not fully
+// take out, and wanders by a percent either way.
+//
+// Every step is checked against the rules the charger must keep: fast only on USB that has stayed attached for
+// CHARGE_SETTLE_UPDATES, and never with the strip or other load on; unplugged at once when USB goes. Each run
+// prints how long it spent in each phase.
+
+// updateCharger() is not used here, but its module needs these.
+uint16_t stripCurrent(void) {
+  return 0;
+} // stripCurrent()
+
+
+uint8_t batteryChargePercent(void) {
+  return 0;
+} // batteryChargePercent()
+
+
+#define STEP_S            0.232
+#define CHARGE_CAPACITY_MAH 2200.0
+#define CHARGE_SLOW_MA    450.0
+#define CHARGE_FAST_MA   1000.0
+
+static const char *__phaseNames[] = { "unplugged", "settling", "fast", "limited", "topping", "full" };
+
+struct Battery {
+  double mah;        // Charge held
+  boolean usb;
+  boolean stripOn;
+  double stripMa;
+  uint8_t attached;  // Steps USB has been present, saturating
+};
+
+static ChargeState __state;
+static ChargeInputs __in;
+static Battery __battery;
+static double __phaseSeconds[CHARGE_FULL + 1];
+static int __phaseChanges;
+static int __fastRestarts;   // Out of topping back into fast
+static int __failures;
+static int __stepFailures;
+static uint32_t __seed = 1;
+
+
+static int wander(void) {
+  __seed = __seed * 1103515245UL + 12345;
+  return (int)((__seed >> 16) % 3) - 1;
+} // wander()
+
+
+static double truePercent(void) {
+  return __battery.mah * 100 / CHARGE_CAPACITY_MAH;
+} // truePercent()
+
+
+static void fail(const char *what) {
+  if(__stepFailures++ < 5)
+    printf("    FAIL at %.0f %%: %s\n", truePercent(), what);
+} // fail()
+
+
+static void start(double percent) {
+  __state.phase = CHARGE_UNPLUGGED;
+  __state.settle = 0;
+  __battery.mah = CHARGE_CAPACITY_MAH * percent / 100;
+  __battery.usb = false;
+  __battery.stripOn = false;
+  __battery.stripMa = 0;
+  __battery.attached = 0;
+  for(int i = 0; i <= CHARGE_FULL; i++)
+    __phaseSeconds[i] = 0;
+  __phaseChanges = __fastRestarts = __stepFailures = 0;
+} // start()
+
+
+static void step(void) {
+  __battery.attached = __battery.usb ? (__battery.attached < 255 ? __battery.attached + 1 : 255) : 0;
+
+  // What the gauge would read.
+  double charging = 0;
+  if(__battery.usb)
+  {
+    double rate = chargeFast(__state.phase) ? CHARGE_FAST_MA : CHARGE_SLOW_MA;
+    double taper = truePercent() < 90 ? 1 : (100 - truePercent()) / 10;
+    charging = rate * (taper > 0 ? taper : 0);
+  }
+  double reading = truePercent() + charging / 250 - (__battery.stripOn ? __battery.stripMa / 300 : 0) + wander();
+  __in.usb = __battery.usb;
+  __in.stripOn = __battery.stripOn;
+  __in.loadMa = __battery.stripOn ? (uint16_t)__battery.stripMa : 0;
+  __in.percent = reading < 0 ? 0 : reading > 100 ? 100 : (uint8_t)reading;
+
+  uint8_t before = __state.phase;
+  updateChargeState(&__state, &__in);
+
+  if(!__battery.usb && __state.phase != CHARGE_UNPLUGGED)
+    fail("not unplugged with USB gone");
+  if(chargeFast(__state.phase) && __battery.attached <= CHARGE_SETTLE_UPDATES)
+    fail("fast charging before USB had settled");
+  if(chargeFast(__state.phase) && (__battery.stripOn || __in.loadMa > CHARGE_LOAD_LIMIT_MA))
+    fail("fast charging under load");
+  if(__state.phase != before)
+  {
+    __phaseChanges++;
+    if(before == CHARGE_TOPPING && __state.phase == CHARGE_FAST)
+      __fastRestarts++;
+  }
+  __phaseSeconds[__state.phase] += STEP_S;
+
+  // USB runs the unit and the strip when it is there. Otherwise the battery does.
+  double drain = 40 + (__battery.stripOn ? __battery.stripMa : 0);
+  __battery.mah += (__battery.usb ? charging : -drain) * STEP_S / 3600;
+  if(__battery.mah > CHARGE_CAPACITY_MAH)
+    __battery.mah = CHARGE_CAPACITY_MAH;
+  if(__battery.mah < 0)
+    __battery.mah = 0;
+} // step()
+
+
+static void steps(double seconds) {
+  for(long n = (long)(seconds / STEP_S); n > 0; n--)
+    step();
+} // steps()
+
+
+static void report(const char *name, boolean ok) {
+  printf("  %-50s", name);
+  for(int i = 0; i <= CHARGE_FULL; i++)
+    if(__phaseSeconds[i] >= 1)
+      printf(" %s %.0f%s", __phaseNames[i], __phaseSeconds[i] >= 120 ? __phaseSeconds[i] / 60 : __phaseSeconds[i],
+             __phaseSeconds[i] >= 120 ? " min" : " s");
+  printf(", %d changes%s\n", __phaseChanges, ok && !__stepFailures ? "" : "  FAIL");
+  if(!ok || __stepFailures)
+    __failures++;
+} // report()
+
+
+static void chargeToFull(void) {
+  start(20);
+  __battery.usb = true;
+  double seconds = 0;
+  while(__state.phase != CHARGE_FULL && seconds < 6 * 3600)
+  {
+    step();
+    seconds += STEP_S;
+  }
+  steps(600);
+  report("attach at 20%, strip off, to full", __state.phase == CHARGE_FULL && __fastRestarts <= 1
+         && __phaseSeconds[CHARGE_FAST] > __phaseSeconds[CHARGE_TOPPING]);
+  printf("    %.0f min to full, %d restarts of fast charging from the top off\n", seconds / 60, __fastRestarts);
+} // chargeToFull()
+
+
+static void stripDuringCharge(void) {
+  start(30);
+  __battery.usb = true;
+  steps(300);
+  boolean fastBefore = __state.phase == CHARGE_FAST;
+  __battery.stripOn = true;
+  __battery.stripMa = 900;
+  steps(600);
+  boolean limited = __state.phase == CHARGE_LIMITED;
+  __battery.stripOn = false;
+  steps(300);
+  report("strip on for 10 min while fast charging", fastBefore && limited && __state.phase == CHARGE_FAST);
+} // stripDuringCharge()
+
+
+// A loose connector: USB comes and goes every half second or so for 20 s, then stays.
+static void wigglyAttach(void) {
+  start(50);
+  for(int i = 0; i < 40; i++)
+  {
+    __battery.usb = !__battery.usb;
+    for(int n = 0; n < 1 + i % 3; n++)
+      step();
+  }
+  boolean neverFast = __phaseSeconds[CHARGE_FAST] == 0;
+  __battery.usb = true;
+  steps(30);
+  report("USB coming and going for 20 s, then attached", neverFast && __state.phase == CHARGE_FAST);
+} // wigglyAttach()
+
+
+static void detachWhileFast(void) {
+  start(25);
+  __battery.usb = true;
+  steps(60);
+  boolean fast = __state.phase == CHARGE_FAST;
+  __battery.usb = false;
+  step();
+  report("unplugged while fast charging", fast && __state.phase == CHARGE_UNPLUGGED);
+} // detachWhileFast()
+
+
+// Full on USB with the strip off, then the strip on: its sag pulls the reading down, and the charger takes it
+// from there at 450 mA. When the strip goes off the reading jumps back, but it must not go fast near the top.
+static void sagWhenFull(void) {
+  start(99);
+  __battery.usb = true;
+  steps(1800);
+  boolean full = __state.phase == CHARGE_FULL;
+  __battery.stripOn = true;
+  __battery.stripMa = 1500;
+  steps(600);
+  __battery.stripOn = false;
+  steps(600);
+  report("full, then a 1.5 A strip load sagging the gauge", full && __phaseSeconds[CHARGE_FAST] == 0);
+} // sagWhenFull()
+
+
+// Unplugged and run down with a heavy strip load, which reads low by the sag, then plugged in with it still on.
+static void sagOnBattery(void) {
+  start(70);
+  __battery.stripOn = true;
+  __battery.stripMa = 1200;
+  steps(1200);
+  __battery.usb = true;
+  steps(600);
+  boolean limited = __state.phase == CHARGE_LIMITED;
+  __battery.stripOn = false;
+  steps(600);
+  report("run down under load, plugged in with the strip on", limited && __state.phase == CHARGE_FAST);
+} // sagOnBattery()
+
+
+int main(int argc, char **argv) {
+  printf("charger: fast %.0f mA, slow %.0f mA, %.0f mAh cell, one step per %.0f ms battery update\n",
+         CHARGE_FAST_MA, CHARGE_SLOW_MA, CHARGE_CAPACITY_MAH, STEP_S * 1000);
+  chargeToFull();
+  stripDuringCharge();
+  wigglyAttach();
+  detachWhileFast();
+  sagWhenFull();
+  sagOnBattery();
+
+  printf("%s\n", __failures ? "FAILED" : "passed");
+  return __failures ? 1 : 0;
+} // main()
+
+// End of file.
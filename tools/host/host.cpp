@@ -0,0 +1,91 @@
+#include <errno.h>
+#include <unistd.h>
+#include <Arduino.h>
+
+// The registers from avr/io.h. All zero to start with, as after a reset.
+#define HOST_DEFINE_REGISTER(name) volatile uint8_t name;
+HOST_REGISTERS(HOST_DEFINE_REGISTER)
+#undef HOST_DEFINE_REGISTER
+
+
+// An unconnected pin reads as noise.
+int analogRead(uint8_t pin) {
+  return rand() & 0x3FF;
+} // analogRead()
+
+
+void (*hostInterruptHandler[4])(void);
+
+void attachInterrupt(uint8_t interrupt, void (*handler)(void), int mode) {
+  if(interrupt < 4)
+    hostInterruptHandler[interrupt] = handler;
+} // attachInterrupt()
+
+
+void detachInterrupt(uint8_t interrupt) {
+  if(interrupt < 4)
+    hostInterruptHandler[interrupt] = 0;
+} // detachInterrupt()
+
+
+HardwareSerial Serial, Serial1;
+
+HardwareSerial::HardwareSerial() : rx(-1), head(0), tail(0) {
+  for(int i = 0; i < HOST_SERIAL_TX; i++)
+    tx[i] = -1;
+} // HardwareSerial()
+
+
+int HardwareSerial::available(void) {
+  return (SERIAL_BUFFER_SIZE + head - tail) % SERIAL_BUFFER_SIZE;
+} // available()
+
+
+int HardwareSerial::peek(void) {
+  return head == tail ? -1 : buffer[tail];
+} // peek()
+
+
+int HardwareSerial::read(void) {
+  if(head == tail)
+    return -1;
+  uint8_t c = buffer[tail];
+  tail = (tail + 1) % SERIAL_BUFFER_SIZE;
+  return c;
+} // read()
+
+
+size_t HardwareSerial::write(uint8_t c) {
+  return write(&c, 1);
+} // write()
+
+
+size_t HardwareSerial::write(const uint8_t *data, size_t size) {
+  for(int i = 0; i < HOST_SERIAL_TX; i++)
+    for(size_t done = 0; tx[i] >= 0 && done < size; )
+    {
+      ssize_t n = ::write(tx[i], data + done, size - done);
+      if(n < 0 && errno != EINTR)
+        break;
+      done += n > 0 ? n : 0;
+    }
+  return size;
+} // write()
+
+
+// One slot is always left empty, so a full buffer holds SERIAL_BUFFER_SIZE - 1, as in the core.
+int HardwareSerial::receive(void) {
+  int room = SERIAL_BUFFER_SIZE - 1 - available();
+  if(rx < 0 || room == 0)
+    return 0;
+  uint8_t data[SERIAL_BUFFER_SIZE];
+  ssize_t n = ::read(rx, data, room);
+  for(ssize_t i = 0; i < n; i++)
+  {
+    buffer[head] = data[i];
+    head = (head + 1) % SERIAL_BUFFER_SIZE;
+  }
+  return n > 0 ? n : 0;
+} // receive()
+
+// End of file.
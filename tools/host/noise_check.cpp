@@ -0,0 +1,304 @@
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include "noise.h"
+
+// Statistical quality of the xorshift generator and the range mapping, the shape of the noise functions,
+// and what each costs next to Arduino random(). Run by tools/host_checks.py.
+//
+// The chi-square limits are the 0.1% points, so a good generator fails one about one run in a thousand. The
+// generator is deterministic from its built in seed, so a pass is a pass every time.
+
+static int __failures;
+
+static void check(boolean ok, const char *what, double value, double limit) {
+  printf("  %-60s %10.2f  %s %.2f%s\n", what, value, ok ? "within" : "OUTSIDE", limit, ok ? "" : "  FAIL");
+  if(!ok)
+    __failures++;
+} // check()
+
+
+// Chi-square of observed counts against a flat expectation.
+static double chiSquare(const unsigned long *counts, int bins, unsigned long total) {
+  double expected = (double)total / bins;
+  double sum = 0;
+  for(int i = 0; i < bins; i++)
+    sum += (counts[i] - expected) * (counts[i] - expected) / expected;
+  return sum;
+} // chiSquare()
+
+
+// The 0.1% point of chi-square with dof degrees of freedom, from the Wilson-Hilferty approximation.
+static double chiLimit(int dof) {
+  double z = 3.09;
+  double a = 2.0 / (9.0 * dof);
+  return dof * pow(1 - a + z * sqrt(a), 3);
+} // chiLimit()
+
+
+static void checkPeriod(void) {
+  static unsigned char seen[65536];
+  uint16_t first = random16();
+  unsigned long period = 1;
+  seen[first] = 1;
+  for(;;)
+  {
+    uint16_t x = random16();
+    if(x == first)
+      break;
+    if(seen[x] || period > 70000)
+    {
+      period = 0;
+      break;
+    }
+    seen[x] = 1;
+    period++;
+  }
+  check(period == 65535 && !seen[0], "random16() period, every non-zero state", period, 65535);
+} // checkPeriod()
+
+
+// Well under one period, so these are real tests and not just the full cycle counted out.
+#define SAMPLES 25600UL
+
+static void checkRandom8(void) {
+  unsigned long counts[256];
+
+  memset(counts, 0, sizeof(counts));
+  for(unsigned long i = 0; i < SAMPLES; i++)
+    counts[random8()]++;
+  check(chiSquare(counts, 256, SAMPLES) < chiLimit(255), "random8() chi-square, 256 bins", chiSquare(counts, 256, SAMPLES), chiLimit(255));
+
+  // Pairs of successive values, high nibble against high nibble.
+  memset(counts, 0, sizeof(counts));
+  for(unsigned long i = 0; i < SAMPLES; i++)
+  {
+    uint8_t a = random8();
+    uint8_t b = random8();
+    counts[(a & 0xF0) | (b >> 4)]++;
+  }
+  check(chiSquare(counts, 256, SAMPLES) < chiLimit(255), "random8() successive pairs chi-square", chiSquare(counts, 256, SAMPLES), chiLimit(255));
+
+  // Each bit on half the time.
+  unsigned long ones[8] = { 0 };
+  for(unsigned long i = 0; i < SAMPLES; i++)
+  {
+    uint8_t x = random8();
+    for(int bit = 0; bit < 8; bit++)
+      ones[bit] += (x >> bit) & 1;
+  }
+  double worst = 0;
+  for(int bit = 0; bit < 8; bit++)
+  {
+    double z = fabs(ones[bit] - SAMPLES / 2.0) / sqrt(SAMPLES / 4.0);
+    if(z > worst)
+      worst = z;
+  }
+  check(worst < 3.29, "random8() worst bit balance, sigma", worst, 3.29);
+
+  // Runs up and down: a generator that drifts or alternates has too few or too many.
+  unsigned long runs = 1;
+  uint8_t previous = random8();
+  int direction = 0;
+  unsigned long n = 0;
+  for(unsigned long i = 0; i < SAMPLES; i++)
+  {
+    uint8_t x = random8();
+    if(x == previous)
+      continue;
+    int now = x > previous ? 1 : -1;
+    if(direction && now != direction)
+      runs++;
+    direction = now;
+    previous = x;
+    n++;
+  }
+  double expected = (2.0 * n - 1) / 3.0;
+  double z = fabs(runs - expected) / sqrt((16.0 * n - 29) / 90.0);
+  check(z < 3.29, "random8() runs up and down, sigma", z, 3.29);
+} // checkRandom8()
+
+
+// random8(lim) maps with a multiply and shift. Four whole periods of the generator give exact counts, so this is
+// the bias of the mapping alone: no value may be more than 1% more likely than another.
+static void checkRanges(void) {
+  static const uint8_t limits[] = { 3, 10, 33, 100, 200, 255 };
+  for(unsigned i = 0; i < sizeof(limits); i++)
+  {
+    uint8_t lim = limits[i];
+    unsigned long counts[256];
+    memset(counts, 0, sizeof(counts));
+    unsigned long total = 65535UL * 4;
+    boolean inRange = true;
+    for(unsigned long n = 0; n < total; n++)
+    {
+      uint8_t x = random8(lim);
+      if(x >= lim)
+        inRange = false;
+      else
+        counts[x]++;
+    }
+    unsigned long least = counts[0], most = counts[0];
+    for(int v = 1; v < lim; v++)
+    {
+      if(counts[v] < least)
+        least = counts[v];
+      if(counts[v] > most)
+        most = counts[v];
+    }
+    double bias = (double)most / least;
+    char what[64];
+    snprintf(what, sizeof(what), "random8(%d) most/least likely value", lim);
+    check(inRange && bias < 1.01, what, bias, 1.01);
+  }
+} // checkRanges()
+
+
+// Noise has to use the range, sit round the middle and have no jumps. A crease at the lattice points would show
+// as a bigger step there than anywhere inside the cells.
+static void checkNoise(const char *name, uint8_t (*noise)(uint16_t, uint16_t), int maxStep) {
+  int least = 255, most = 0, worstStep = 0, worstLattice = 0;
+  double sum = 0;
+  unsigned long count = 0;
+  for(uint32_t y = 0; y < 65536; y += 97)
+  {
+    int previous = noise(0, y);
+    for(uint32_t x = 1; x < 65536; x++)
+    {
+      int n = noise(x, y);
+      sum += n;
+      count++;
+      if(n < least)
+        least = n;
+      if(n > most)
+        most = n;
+      int step = abs(n - previous);
+      if((x & 0xFF) == 0)
+      {
+        if(step > worstLattice)
+          worstLattice = step;
+      } else if(step > worstStep) {
+        worstStep = step;
+      }
+      previous = n;
+    }
+  }
+  char what[64];
+  snprintf(what, sizeof(what), "%s range used, of 255", name);
+  check(most - least >= 200, what, most - least, 200);
+  snprintf(what, sizeof(what), "%s mean, centred on 128", name);
+  check(fabs(sum / count - 128) < 8, what, sum / count, 8);
+  snprintf(what, sizeof(what), "%s worst step per 1/256 cell", name);
+  check(worstStep <= maxStep, what, worstStep, maxStep);
+  snprintf(what, sizeof(what), "%s worst step across a lattice point", name);
+  check(worstLattice <= worstStep, what, worstLattice, worstStep);
+} // checkNoise()
+
+
+static uint8_t inoise8x(uint16_t x, uint16_t y) {
+  return inoise8(x);
+} // inoise8x()
+
+
+static uint8_t inoise8xy(uint16_t x, uint16_t y) {
+  return inoise8(x, y);
+} // inoise8xy()
+
+
+static uint8_t vnoise8xy(uint16_t x, uint16_t y) {
+  return vnoise8(x, y);
+} // vnoise8xy()
+
+
+static uint8_t inoise16x(uint16_t x, uint16_t y) {
+  return inoise16((uint32_t)x << 8) >> 8;
+} // inoise16x()
+
+
+static uint8_t inoise16xy(uint16_t x, uint16_t y) {
+  return inoise16((uint32_t)x << 8, (uint32_t)y << 8) >> 8;
+} // inoise16xy()
+
+
+// avr-libc's random(): Park and Miller's minimal standard generator, 31 bits by Schrage's method, which is two
+// 32-bit divisions. Arduino's random(min, max) adds a 32-bit modulo on top.
+static long __libcState = 1;
+
+static long libcRandom(void) {
+  long hi = __libcState / 127773L;
+  long lo = __libcState % 127773L;
+  long x = 16807L * lo - 2836L * hi;
+  if(x < 0)
+    x += 0x7FFFFFFFL;
+  __libcState = x;
+  return x;
+} // libcRandom()
+
+
+static long arduinoRandom(long low, long high) {
+  return libcRandom() % (high - low) + low;
+} // arduinoRandom()
+
+
+static volatile uint32_t __sink;
+
+static double nowNs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+} // nowNs()
+
+
+#define BENCH_CALLS 10000000UL
+
+#define BENCH(label, expression) \
+  { \
+    uint32_t sum = 0; \
+    double start = nowNs(); \
+    for(unsigned long i = 0; i < BENCH_CALLS; i++) \
+      sum += (expression); \
+    double ns = (nowNs() - start) / BENCH_CALLS; \
+    __sink = sum; \
+    if(!baseline) \
+      baseline = ns; \
+    printf("  %-32s %8.2f ns  %6.2fx\n", label, ns, ns / baseline); \
+  }
+
+static void benchmark(void) {
+  double baseline = 0;
+  printf("cost per call on this machine, against Arduino random(min, max)\n");
+  BENCH("random(0, 32)      (Arduino)",  arduinoRandom(0, 32));
+  BENCH("random8()",                     random8());
+  BENCH("random8(32)",                   random8(32));
+  BENCH("random16(1000)",                random16(1000));
+  BENCH("inoise8(x)",                    inoise8((uint16_t)(i * 37)));
+  BENCH("inoise8(x, y)",                 inoise8((uint16_t)(i * 37), (uint16_t)(i >> 3)));
+  BENCH("vnoise8(x, y)",                 vnoise8((uint16_t)(i * 37), (uint16_t)(i >> 3)));
+  BENCH("inoise16(x)",                   inoise16(i * 997));
+  BENCH("inoise16(x, y)",                inoise16(i * 997, i << 5));
+  printf("  The desktop divides in hardware. The 32U4 does not: a 32-bit division there is a ~600 cycle\n"
+         "  library call, and Arduino random(min, max) makes three of them.\n");
+} // benchmark()
+
+
+int main(int argc, char **argv) {
+  printf("xorshift16 and range mapping\n");
+  checkPeriod();
+  checkRandom8();
+  checkRanges();
+
+  printf("noise\n");
+  checkNoise("inoise8(x)", inoise8x, 6);
+  checkNoise("inoise8(x, y)", inoise8xy, 6);
+  checkNoise("vnoise8(x, y)", vnoise8xy, 6);
+  checkNoise("inoise16(x) high byte", inoise16x, 6);
+  checkNoise("inoise16(x, y) high byte", inoise16xy, 6);
+
+  if(argc < 2 || strcmp(argv[1], "--no-bench"))
+    benchmark();
+
+  printf("%s\n", __failures ? "FAILED" : "passed");
+  return __failures ? 1 : 0;
+} // main()
+
+// End of file.
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <time.h>
+#include "particles.h"
+#include "noise.h"
+#include "orion.h"
+
+// Cost per particle of updating and emitting at 8, 32 and 64 live particles, and the pool's bookkeeping under a
+// steady stream of bursts. Built with PARTICLE_POOL_SIZE 64. Run by tools/host_checks.py.
+//
+// Drawing is drawParticles() in orion.cpp, on the strip, so it is not timed here. It is two
+// addPixelAtBrightness() calls per live particle and nothing per pixel.
+
+static ParticlePool __pool;
+static ParticlePool __snapshot;
+static int          __failures;
+static volatile uint32_t __sink;
+
+static double nowNs(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+} // nowNs()
+
+
+static void fail(const char *what) {
+  printf("  FAIL: %s\n", what);
+  __failures++;
+} // fail()
+
+
+// A pool of live particles spread over the strip, as a fireworks frame might hold.
+static void fillPool(uint8_t live) {
+  resetParticles(&__snapshot);
+  while(particles->count < live)
+    emitParticle(random16(PIXEL_COUNT << 8), (int8_t)random8(64) - 32, random8(), 128 + random8(127));
+} // fillPool()
+
+
+#define FRAMES 2000000UL
+
+// One frame's update from the same starting pool, over and over. The copy back is timed on its own and taken off.
+static double updateCost(uint8_t live) {
+  fillPool(live);
+  resetParticles(&__pool);
+
+  double start = nowNs();
+  for(unsigned long i = 0; i < FRAMES; i++)
+  {
+    memcpy(&__pool, &__snapshot, sizeof(__pool));
+    __sink += __pool.count;
+  }
+  double copy = nowNs() - start;
+
+  start = nowNs();
+  for(unsigned long i = 0; i < FRAMES; i++)
+  {
+    memcpy(&__pool, &__snapshot, sizeof(__pool));
+    updateParticles(6, 1);
+    __sink += __pool.count;
+  }
+  return (nowNs() - start - copy) / FRAMES / live;
+} // updateCost()
+
+
+static double emitCost(uint8_t live) {
+  resetParticles(&__pool);
+  unsigned long emitted = 0;
+
+  double start = nowNs();
+  for(unsigned long i = 0; i < FRAMES / 8; i++)
+  {
+    __pool.count = 0;
+    emitted += emitBurst(random16(PIXEL_COUNT << 8), live, 48, random8(), 255);
+  }
+  return (nowNs() - start) / emitted;
+} // emitCost()
+
+
+// A long run of fireworks frames: the pool must stay packed and bounded, and full must mean fewer, not none.
+static void checkPool(void) {
+  resetParticles(&__pool);
+  unsigned long frames = 0, full = 0;
+  for(frames = 0; frames < 200000; frames++)
+  {
+    if(random8() < 40)
+      emitBurst(random16(PIXEL_COUNT << 8), 24, 48, random8(), 255);
+    updateParticles(6, 0);
+    if(__pool.count > PARTICLE_POOL_SIZE)
+    {
+      fail("more live particles than the pool holds");
+      return;
+    }
+    if(__pool.count == PARTICLE_POOL_SIZE)
+      full++;
+    for(uint8_t i = 0; i < __pool.count; i++)
+    {
+      if(__pool.life[i] == 0 || __pool.pos[i] >= (uint16_t)PIXEL_COUNT << 8)
+      {
+        fail("a dead particle left among the live ones");
+        return;
+      }
+    }
+  }
+  if(!full)
+    fail("the pool never filled, so the full case was not tried");
+  __pool.count = PARTICLE_POOL_SIZE;
+  if(emitBurst(0, 4, 8, 0, 255) != 0)
+    fail("a full pool took a particle");
+  __pool.count = PARTICLE_POOL_SIZE - 2;
+  if(emitBurst(0, 4, 8, 0, 255) != 2)
+    fail("a nearly full pool did not take what it had room for");
+  printf("  pool: %lu frames, %lu of them full, bounded and packed throughout\n", frames, full);
+} // checkPool()
+
+
+int main(int argc, char **argv) {
+  printf("pool of %d, %d bytes, on a %d pixel strip\n", PARTICLE_POOL_SIZE, (int)sizeof(ParticlePool), PIXEL_COUNT);
+  checkPool();
+
+  if(argc < 2 || strcmp(argv[1], "--no-bench"))
+  {
+    static const uint8_t lives[] = { 8, 32, 64 };
+    printf("  live   update ns/particle   emit ns/particle   update ns/frame\n");
+    for(unsigned i = 0; i < sizeof(lives); i++)
+    {
+      double update = updateCost(lives[i]);
+      double emit = emitCost(lives[i]);
+      printf("  %4d   %18.2f   %16.2f   %15.1f\n", lives[i], update, emit, update * lives[i]);
+    }
+  }
+
+  printf("%s\n", __failures ? "FAILED" : "passed");
+  return __failures ? 1 : 0;
+} // main()
+
+// End of file.
@@ -0,0 +1,126 @@
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include "serialStream.h"
+
+// The serial stream parser as the unit runs it: serialStream.cpp on a strip of --pixels, with Serial on the far
+// end of a pty in place of the USB cable. tools/host_checks.py feeds it frames and broken frames, and
+// tools/stream_sender.py --loopback streams to it.
+//
+//   stream_unit --fd <descriptor> [--pixels <n>]
+//
+// Each completed frame is shown at once, which sends the '#' ack, and printed on stdout as
+// "F <frame> <pixels>", each pixel as six hex digits of 7 bit R G B. A telemetry dump request prints "D" and
+// answers "T end" on the serial line. It runs until the pty is closed.
+
+static LPD8806  __strip(8);
+static uint8_t  __rgb[1024][3];
+static unsigned __frames;
+
+
+// The strip is the one piece of LPD8806.cpp the parser uses. The rest of it needs SPI and the pins.
+LPD8806::LPD8806(uint16_t n) {
+  numLEDs = n;
+} // LPD8806()
+
+
+uint16_t LPD8806::numPixels(void) {
+  return numLEDs;
+} // numPixels()
+
+
+void LPD8806::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  if(n >= numLEDs)
+    return;
+  __rgb[n][0] = r;
+  __rgb[n][1] = g;
+  __rgb[n][2] = b;
+} // setPixelColor()
+
+
+void LPD8806::updateLength(uint16_t n) {
+  numLEDs = n < 1024 ? n : 1024;
+} // updateLength()
+
+
+void dumpTelemetryLog(void) {
+  printf("D\n");
+  fflush(stdout);
+  Serial.write((const uint8_t *)"T end\r\n", 7);
+} // dumpTelemetryLog()
+
+
+static long long hostMicros(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (long long)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+} // hostMicros()
+
+
+unsigned long timeMicros(void) {
+  return hostMicros();
+} // timeMicros()
+
+
+unsigned long timeMillis(void) {
+  return hostMicros() / 1000;
+} // timeMillis()
+
+
+static void showFrame(void) {
+  printf("F %u ", ++__frames);
+  for(uint16_t i = 0; i < __strip.numPixels(); i++)
+    printf("%02x%02x%02x", __rgb[i][0], __rgb[i][1], __rgb[i][2]);
+  printf("\n");
+  fflush(stdout);
+  streamFrameShown();
+} // showFrame()
+
+
+int main(int argc, char **argv) {
+  int fd = -1;
+  for(int i = 1; i + 1 < argc; i += 2)
+  {
+    if(!strcmp(argv[i], "--fd"))
+      fd = atoi(argv[i + 1]);
+    else if(!strcmp(argv[i], "--pixels"))
+      __strip.updateLength(atoi(argv[i + 1]));
+    else
+    {
+      fprintf(stderr, "stream_unit: unknown argument %s\n", argv[i]);
+      return 2;
+    }
+  }
+  if(fd < 0)
+  {
+    fprintf(stderr, "stream_unit: give --fd\n");
+    return 2;
+  }
+  Serial.rx = Serial.tx[0] = fd;
+
+  for(;;)
+  {
+    // As the render task polls it: a pass at a time until the buffer is empty, and at least every 100 ms.
+    do
+    {
+      if(receiveStream(__strip))
+        showFrame();
+    } while(Serial.available());
+
+    fd_set ready;
+    FD_ZERO(&ready);
+    FD_SET(fd, &ready);
+    struct timeval timeout = { 0, 100000 };
+    int n = select(fd + 1, &ready, 0, 0, &timeout);
+    if(n < 0 && errno != EINTR)
+      break;
+    // The buffer is empty here, so readable with nothing to take means the pty was closed.
+    if(n > 0 && !Serial.receive())
+      break;
+  }
+  return 0;
+} // main()
+
+// End of file.
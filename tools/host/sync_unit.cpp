@@ -0,0 +1,200 @@
+#include <stdio.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include "orion.h"
+#include "frameSync.h"
+#include "timeBase.h"
+#include "scheduler.h"
+
+// One unit on a frame sync bus: frameSync.cpp and animationClock.cpp as the unit runs them, with Serial1 on a
+// socket in place of the UART. Built as the leader and as a follower; tools/host_checks.py starts one leader and
+// several followers, joined by a socketpair per follower, and measures their clocks against each other.
+//
+//   sync_unit --start <us> --seconds <s> [--tx <fd>]... [--rx <fd>] [--ppm <p>] [--offset <us>]
+//             [--mode <m>] [--speed <n>] [--power-on <s>] [--unplug <from s> <to s>]
+//
+// --start is the CLOCK_MONOTONIC microsecond every unit starts at, so their times line up. timeMicros() runs
+// --ppm fast or slow against it, from --offset, in whole 4 us ticks as on the unit.
+// The loop stands in for the scheduler: it sleeps until the next step is due, the time frameSync.cpp asked to
+// be woken at, or a byte arrives. A byte arriving while INT2 is armed calls the RX edge handler then and there.
+// Host scheduling latency stands in for the unit's interrupt latency, and is far worse.
+//
+// Every SAMPLE_MS it prints "C <us since start> <mode> <cycles> <animation clock> <rate>", and at the end
+// "S <beacons> <average us> <worst us> <trim ppm> <mode changes>" from readSyncError().
+//
+// unsigned long is 64 bits here, so the 71 minute wrap of timeMicros() is not exercised.
+
+#define SAMPLE_MS 20
+
+int mode, syspeed;
+
+static long long     __start;          // CLOCK_MONOTONIC us
+static double        __ppm;
+static unsigned long __offset;
+static unsigned long __wakeAt;
+static int           __modeChanges;
+
+
+static long long hostMicros(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (long long)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+} // hostMicros()
+
+
+// timeMicros() at host time host.
+static unsigned long unitMicros(long long host) {
+  double us = (host - __start) * (1 + __ppm / 1e6) + __offset;
+  return (unsigned long)us / TIME_BASE_US_PER_TICK * TIME_BASE_US_PER_TICK;
+} // unitMicros()
+
+
+unsigned long timeMicros(void) {
+  return unitMicros(hostMicros());
+} // timeMicros()
+
+
+unsigned long timeMillis(void) {
+  return timeMicros() / 1000;
+} // timeMillis()
+
+
+void wakeBy(unsigned long atMicros) {
+  if((long)(atMicros - __wakeAt) < 0)
+    __wakeAt = atMicros;
+} // wakeBy()
+
+
+// The rest of orion.cpp that the clock and frame sync use.
+byte modeFramePeriod(int m) {
+  return 5;
+} // modeFramePeriod()
+
+
+byte modeCount(void) {
+  return 4;
+} // modeCount()
+
+
+void changeMode(int m) {
+  mode = m;
+  resetAnimationClock();
+  __modeChanges++;
+} // changeMode()
+
+
+static void sample(long long host) {
+  uint32_t animation, cycles;
+  readAnimationClocks(unitMicros(host), &animation, &cycles);
+  printf("C %lld %d %lu %lu %lu\n", host - __start, mode, (unsigned long)cycles, (unsigned long)animation,
+         (unsigned long)animationClockRate());
+} // sample()
+
+
+int main(int argc, char **argv) {
+  double seconds = 10, powerOn = 0, unplugFrom = -1, unplugTo = -1;
+  int txCount = 0;
+  for(int i = 1; i < argc; i++)
+  {
+    const char *arg = argv[i];
+    const char *value = i + 1 < argc ? argv[i + 1] : "0";
+    if(!strcmp(arg, "--start"))
+      __start = atoll(value);
+    else if(!strcmp(arg, "--seconds"))
+      seconds = atof(value);
+    else if(!strcmp(arg, "--tx") && txCount < HOST_SERIAL_TX)
+      Serial1.tx[txCount++] = atoi(value);
+    else if(!strcmp(arg, "--rx"))
+      Serial1.rx = atoi(value);
+    else if(!strcmp(arg, "--ppm"))
+      __ppm = atof(value);
+    else if(!strcmp(arg, "--offset"))
+      __offset = strtoul(value, 0, 10);
+    else if(!strcmp(arg, "--mode"))
+      mode = atoi(value);
+    else if(!strcmp(arg, "--speed"))
+      syspeed = atoi(value);
+    else if(!strcmp(arg, "--power-on"))
+      powerOn = atof(value);
+    else if(!strcmp(arg, "--unplug") && i + 2 < argc)
+    {
+      unplugFrom = atof(value);
+      unplugTo = atof(argv[i + 2]);
+      i++;
+    }
+    else
+    {
+      fprintf(stderr, "sync_unit: unknown argument %s\n", arg);
+      return 2;
+    }
+    i++;
+  }
+
+  while(hostMicros() < __start)
+    usleep(1000);
+
+  resetAnimationClock();
+  startFrameSync();
+  long long end = __start + (long long)(seconds * 1e6);
+  long long nextSample = __start;
+  for(long long host = hostMicros(); host < end; host = hostMicros())
+  {
+    double t = (host - __start) / 1e6;
+    unsigned long now = unitMicros(host);
+
+    if(Serial1.rx >= 0)
+    {
+      fd_set ready;
+      FD_ZERO(&ready);
+      FD_SET(Serial1.rx, &ready);
+      struct timeval none = { 0, 0 };
+      if(select(Serial1.rx + 1, &ready, 0, 0, &none) > 0)
+      {
+        if(t >= unplugFrom && t < unplugTo)
+        {
+          char lost[256];
+          if(read(Serial1.rx, lost, sizeof(lost)) <= 0)
+            break;
+        } else {
+          if((EIMSK & (1 << INT2)) && hostInterruptHandler[INT2])
+            hostInterruptHandler[INT2]();
+          Serial1.receive();
+        }
+      }
+    }
+
+    __wakeAt = now + 10000;
+    updateFrameSync(t >= powerOn);
+    advanceAnimationClock();
+    if(host >= nextSample)
+    {
+      sample(host);
+      nextSample += SAMPLE_MS * 1000;
+    }
+
+    // Sleep until the first thing due, on the host's clock.
+    wakeBy(nextFrameDue());
+    long long wait = (long long)((long)(__wakeAt - timeMicros()) / (1 + __ppm / 1e6));
+    if(nextSample - hostMicros() < wait)
+      wait = nextSample - hostMicros();
+    if(wait <= 0)
+      continue;
+    fd_set ready;
+    FD_ZERO(&ready);
+    if(Serial1.rx >= 0)
+      FD_SET(Serial1.rx, &ready);
+    struct timeval timeout = { (time_t)(wait / 1000000), (suseconds_t)(wait % 1000000) };
+    if(select(Serial1.rx + 1, &ready, 0, 0, &timeout) < 0 && errno != EINTR)
+      break;
+  }
+
+  uint16_t beacons;
+  unsigned long average, worst;
+  readSyncError(&beacons, &average, &worst);
+  printf("S %u %lu %lu %d %d\n", beacons, average, worst, syncTrimPpm(), __modeChanges);
+  return 0;
+} // main()
+
+// End of file.
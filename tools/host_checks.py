@@ -0,0 +1,403 @@
+#!/usr/bin/env python3
+"""Build the sketch's hardware free modules on this machine and check them against known input.
+
+Each check is a small C++ program in tools/host/ built with g++ against the sketch's own sources, unchanged.
+tools/host/Arduino.h stands in for the Arduino core, with the registers as plain variables.
+
+    tools/host_checks.py              every check
+    tools/host_checks.py noise        just the named checks
+    tools/host_checks.py --no-bench   skip the timings
+    tools/host_checks.py audio --wav set.wav --trace   also feed a recording through the audio analysis
+
+The sync check runs frameSync.cpp and the animation clock as one leader and several followers, each its own
+process with its own clock error, joined by a socketpair per follower in place of the UART wiring. It compares
+every follower's clock with the leader's from outside and checks each comes into step and stays there through a
+mode mismatch, a late power on and a pulled cable. Host scheduling latency stands in for the unit's interrupt
+latency and is far worse, so a real bus should do better.
+
+The stream check feeds serialStream.cpp frames through a pty as the USB serial link: every encoding, frames
+longer than the strip, zero length delta spans, runs and spans past the end, a frame cut short, and "dump"
+both between frames and inside pixel data. Each case says what the strip must hold after each frame.
+
+The audio check makes its own WAV test vectors with known beats (kicks alone, kicks in a mix, silence, and a
+steady hum and kicks with samples dropped as a ring overrun would) and checks the beat detector finds every
+kick and nothing else. --wav adds recordings of your own; their beats and levels are printed, not checked.
+
+A check prints what it measured against each limit and fails if any is outside it. Timings are this machine's,
+not the 32U4's: they compare one way of doing a thing with another, they do not give its cost on the unit.
+"""
+
+import argparse
+import math
+import os
+import pty
+import random
+import select
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+import tty
+import wave
+
+import stream_sender
+
+TOOLS = os.path.dirname(os.path.abspath(__file__))
+HOST = os.path.join(TOOLS, "host")
+SKETCH = os.path.join(TOOLS, "..", "Synthesia_Orion")
+
+WAV_RATE = 16000
+
+
+def write_wav(path, samples):
+    with wave.open(path, "wb") as w:
+        w.setnchannels(1)
+        w.setsampwidth(2)
+        w.setframerate(WAV_RATE)
+        w.writeframes(b"".join(int(max(-1, min(1, s)) * 32767).to_bytes(2, "little", signed=True)
+                               for s in samples))
+
+
+def kick(t):
+    """A kick drum: a sine falling from 120 to 50 Hz, dying away over about 100 ms."""
+    if t < 0 or t > 0.3:
+        return 0.0
+    phase = 2 * math.pi * (50 * t + 70 * 0.03 * (1 - math.exp(-t / 0.03)))
+    return 0.9 * math.sin(phase) * math.exp(-t / 0.05)
+
+
+def make_vector(kind, seconds, bpm, rng):
+    """Samples, kick times and other onsets of one test vector."""
+    beat = 60.0 / bpm
+    kicks = [0.5 + i * beat for i in range(int((seconds - 0.5) / beat))]
+    samples = []
+    phase = 0.0
+    for n in range(int(seconds * WAV_RATE)):
+        t = n / float(WAV_RATE)
+        v = 0.0
+        if kind in ("kicks", "mix", "kicks-dropped"):
+            k = int((t - 0.5) / beat) if t >= 0.5 else -1
+            if 0 <= k < len(kicks):
+                v += kick(t - kicks[k])
+            v += rng.gauss(0, 0.003)
+        if kind == "mix":
+            # A bass line in the low mid band and a hi-hat on every off beat.
+            phase += 2 * math.pi * (220 if int(t / beat) % 2 else 262) / WAV_RATE
+            v += 0.2 * math.sin(phase)
+            off = (t - 0.5 - beat / 2) % beat
+            if t > 0.5 and off < 0.03:
+                v += rng.gauss(0, 0.15) * (1 - off / 0.03)
+        if kind == "hum":
+            v += 0.5 * math.sin(2 * math.pi * 100 * t)
+        samples.append(v)
+    if kind in ("hum", "silence"):
+        kicks = []
+    # The bass line and the hum start at once, out of silence: that is an onset too.
+    onsets = [0.0] if kind in ("mix", "hum") else []
+    return samples, kicks, onsets
+
+
+def run_audio(binary, workdir, args):
+    rng = random.Random(1)
+    # name, kind, arguments for the check, seconds, bpm
+    vectors = [
+        ("kicks-120bpm", "kicks", [], 10, 120),
+        ("kicks-160bpm", "kicks", [], 10, 160),
+        ("mix-120bpm", "mix", [], 10, 120),
+        ("silence", "silence", [], 3, 120),
+        ("hum-dropped", "hum", ["--drop-every", "0.37"], 10, 120),
+        ("kicks-dropped", "kicks-dropped", ["--drop-every", "0.37"], 10, 120),
+    ]
+    ok = subprocess.call([binary]) == 0
+    for name, kind, extra, seconds, bpm in vectors:
+        samples, kicks, onsets = make_vector(kind, seconds, bpm, rng)
+        path = os.path.join(workdir, name + ".wav")
+        write_wav(path, samples)
+        output = subprocess.check_output([binary] + extra + [path]).decode()
+        line = next(l for l in output.splitlines() if l.startswith("beats at"))
+        beats = [float(x) for x in line.split()[2:]]
+
+        # Every kick found once, within 40 ms; nothing found between them but the onsets.
+        found = [k for k in kicks if any(k - 0.02 <= b <= k + 0.04 for b in beats)]
+        extra_beats = [b for b in beats if not any(k - 0.02 <= b <= k + 0.04 for k in kicks + onsets)]
+        missed = len(kicks) - len(found)
+        # Dropped samples may take a kick with them, but never add a beat.
+        allowed = len(kicks) // 10 if "dropped" in kind else 0
+        passed = missed <= allowed and not extra_beats
+        print("  %-16s %2d kicks, %2d found, %d missed (limit %d), %d extra beats%s"
+              % (name, len(kicks), len(found), missed, allowed, len(extra_beats), "" if passed else "  FAIL"))
+        ok = ok and passed
+
+    for path in args.wav:
+        subprocess.call([binary] + (["--trace"] if args.trace else []) + [path])
+    return ok
+
+
+SYNC_SECONDS = 10
+SYNC_LEADER_PPM = 1000
+SYNC_AVERAGE_US = 500   # Limits on a follower's error while it should be in step
+SYNC_WORST_US = 4000
+SYNC_TRIM_PPM = 500     # How far the trim may end up from the difference between the two clocks
+# name, arguments, clock error in ppm, (from, to) seconds it must be in step
+SYNC_FOLLOWERS = [
+    ("fast clock", [], 4000, [(2.5, SYNC_SECONDS)]),
+    ("slow clock, on another mode at first", ["--mode", "2"], -4000, [(2.5, SYNC_SECONDS)]),
+    ("powered on at 3 s", ["--power-on", "3"], 2500, [(5.5, SYNC_SECONDS)]),
+    ("cable out from 4 to 7 s", ["--unplug", "4", "7"], -1500, [(2.5, 4), (7.5, SYNC_SECONDS)]),
+]
+
+
+def read_sync_unit(output):
+    """The clock samples, as (us, mode, total clock, rate), and the unit's S line."""
+    samples = []
+    summary = None
+    for line in output.splitlines():
+        fields = line.split()
+        if fields and fields[0] == "C":
+            samples.append((int(fields[1]), int(fields[2]), (int(fields[3]) << 32) + int(fields[4]),
+                            int(fields[5])))
+        elif fields and fields[0] == "S":
+            summary = [int(f) for f in fields[1:]]
+    return samples, summary
+
+
+def run_sync(binary, workdir, args):
+    leader = build("sync", workdir, ["-DFRAME_SYNC=FRAME_SYNC_LEADER"], "sync_leader")
+    rng = random.Random(1)
+    pairs = [socket.socketpair() for _ in SYNC_FOLLOWERS]
+    start = time.monotonic_ns() // 1000 + 300000
+    common = ["--start", str(start), "--seconds", str(SYNC_SECONDS), "--speed", "3"]
+    fds = [a.fileno() for a, b in pairs]
+    units = [subprocess.Popen([leader, "--ppm", str(SYNC_LEADER_PPM)] + common +
+                              sum((["--tx", str(fd)] for fd in fds), []), pass_fds=fds, stdout=subprocess.PIPE)]
+    for (name, extra, ppm, windows), (a, b) in zip(SYNC_FOLLOWERS, pairs):
+        units.append(subprocess.Popen([binary, "--rx", str(b.fileno()), "--ppm", str(ppm),
+                                       "--offset", str(rng.randrange(10 ** 7))] + common + extra,
+                                      pass_fds=[b.fileno()], stdout=subprocess.PIPE))
+    for a, b in pairs:
+        a.close()
+        b.close()
+    outputs = [read_sync_unit(u.communicate()[0].decode()) for u in units]
+
+    leader_samples = outputs[0][0]
+    leader_mode = leader_samples[-1][1]
+    print("  leader %+d ppm, beacon every 250 ms, step 15 ms, %d s; limits %d us average, %d us worst, trim %d ppm"
+          % (SYNC_LEADER_PPM, SYNC_SECONDS, SYNC_AVERAGE_US, SYNC_WORST_US, SYNC_TRIM_PPM))
+    ok = True
+    for (name, extra, ppm, windows), (samples, summary) in zip(SYNC_FOLLOWERS, outputs[1:]):
+        # The leader's clock runs at a steady rate between its samples, so it is known exactly in between.
+        errors = []
+        j = 0
+        for us, mode, total, rate in samples:
+            while j + 1 < len(leader_samples) and leader_samples[j + 1][0] < us:
+                j += 1
+            if j + 1 >= len(leader_samples) or not rate:
+                continue
+            (u0, _, t0, _), (u1, _, t1, _) = leader_samples[j], leader_samples[j + 1]
+            truth = t0 + (t1 - t0) * (us - u0) / float(u1 - u0)
+            errors.append((us / 1e6, abs(total - truth) / rate))
+        steady = [e for t, e in errors if any(a <= t < b for a, b in windows)]
+        average = sum(steady) / max(1, len(steady))
+        worst = max(steady or [0])
+        beacons, self_average, self_worst, trim, changes = summary
+        expected = SYNC_LEADER_PPM - ppm
+        passed = (steady and average <= SYNC_AVERAGE_US and worst <= SYNC_WORST_US and
+                  abs(trim - expected) <= SYNC_TRIM_PPM and samples[-1][1] == leader_mode)
+        print("  %-38s %+5d ppm: trim %+5d ppm (%+d), average %4.0f us, worst %5.0f us, self %d us, %d mode change%s%s"
+              % (name, ppm, trim, expected, average, worst, self_average, changes, "" if changes == 1 else "s",
+                 "" if passed else "  FAIL"))
+        ok = ok and passed
+    return ok and all(u.returncode == 0 for u in units)
+
+
+STREAM_PIXELS = 8
+
+
+def stream_colours(n, base=0):
+    return [((base + 30 * i) % 256, (base + 60 + 20 * i) % 256, (base + 250 - 28 * i) % 256) for i in range(n)]
+
+
+def stream_delta(pixels, body):
+    """A delta frame from its body: skips, and spans as lists of pixels."""
+    out = bytearray(stream_sender.header("d", pixels))
+    for item in body:
+        if isinstance(item, int):
+            out.append(item)
+        else:
+            out.append(len(item))
+            for p in item:
+                out += bytes(p)
+    return bytes(out)
+
+
+def strip_after(*frames):
+    """What the strip holds, in 7 bit, after each frame given as a list of (first pixel, pixels) writes."""
+    strip = [(0, 0, 0)] * STREAM_PIXELS
+    shown = []
+    for writes in frames:
+        for first, pixels in writes:
+            for i, p in enumerate(pixels):
+                if first + i < STREAM_PIXELS:
+                    strip[first + i] = tuple(c >> 1 for c in p)
+        shown.append("".join("%02x%02x%02x" % p for p in strip))
+    return shown
+
+
+def stream_cases():
+    """name, chunks sent (bytes, or a pause in seconds), strip contents after each frame, telemetry dumps."""
+    a = stream_colours(STREAM_PIXELS)
+    b = stream_colours(STREAM_PIXELS, 100)
+    long_frame = stream_colours(12, 50)
+    raw_a = stream_sender.encode_raw(a, None)
+    raw_b = stream_sender.encode_raw(b, None)
+    red, blue = (254, 0, 0), (0, 0, 254)
+    # Pixel bytes that spell "dumpdump" from the second byte on.
+    dumpy = [(1, ord("d"), ord("u")), (ord("m"), ord("p"), ord("d")), (ord("u"), ord("m"), ord("p"))] + a[3:]
+    return [
+        ("raw", [raw_a], strip_after([(0, a)]), 0),
+        ("raw, 12 pixels into 8: the rest read and dropped", [stream_sender.encode_raw(long_frame, None), raw_b],
+         strip_after([(0, long_frame)], [(0, b)]), 0),
+        ("RLE", [stream_sender.encode_rle([red] * 3 + [blue] * 5, None)], strip_after([(0, [red] * 3 + [blue] * 5)]), 0),
+        ("RLE run past the end: frame dropped, next one parsed",
+         [stream_sender.header("r", 8) + bytes([3]) + bytes(red) + bytes([6]) + bytes(blue), raw_b],
+         strip_after([(0, [red] * 3), (0, b)]), 0),
+        ("RLE run of 0: frame dropped, next one parsed",
+         [stream_sender.header("r", 8) + bytes([0]) + bytes(red), raw_b], strip_after([(0, b)]), 0),
+        ("delta with zero length spans",
+         [raw_a, stream_delta(8, [0, [], 2, [], 1, [red, blue], 0, [b[5]], 2])],
+         strip_after([(0, a)], [(3, [red, blue, b[5]])]), 0),
+        ("delta of nothing but a skip", [raw_a, stream_delta(8, [8])], strip_after([(0, a)], []), 0),
+        ("delta skip past the end: frame dropped, next one parsed", [raw_a, stream_delta(8, [9]), raw_b],
+         strip_after([(0, a)], [(0, b)]), 0),
+        ("delta span past the end: frame dropped, next one parsed",
+         [raw_a, stream_delta(8, [4, [red] * 5]), raw_b], strip_after([(0, a)], [(4, [red] * 4), (0, b)]), 0),
+        ("header check wrong: hunts for the next frame",
+         [raw_a[:5] + bytes([raw_a[5] ^ 1]) + raw_a[6:], raw_b], strip_after([(0, b)]), 0),
+        ('"dump" inside pixel data: no dump', [stream_sender.encode_raw(dumpy, None)], strip_after([(0, dumpy)]), 0),
+        ('"dump" between frames, after a stray "d"', [raw_a, b"ddump", raw_b], strip_after([(0, a)], [(0, b)]), 1),
+        ("frame cut short, then a new one after the timeout", [raw_a[:14], 2.2, raw_b], strip_after([(0, b)]), 0),
+    ]
+
+
+def stream_case(binary, chunks, pixels):
+    """Send the chunks to a fresh unit. Returns its frames, dumps and acks."""
+    host, unit_end = pty.openpty()
+    tty.setraw(host)
+    tty.setraw(unit_end)
+    unit = subprocess.Popen([binary, "--fd", str(unit_end), "--pixels", str(pixels)], pass_fds=[unit_end],
+                            stdout=subprocess.PIPE)
+    os.close(unit_end)
+    replies = b""
+    for chunk in chunks:
+        if isinstance(chunk, float):
+            time.sleep(chunk)
+        else:
+            os.write(host, chunk)
+            # The unit acks each frame before the sender goes on, so chunks are never parsed as one.
+            time.sleep(0.02)
+    while select.select([host], [], [], 0.3)[0]:
+        replies += os.read(host, 4096)
+    os.close(host)
+    lines = unit.communicate()[0].decode().splitlines()
+    frames = [l.split()[2] for l in lines if l.startswith("F ")]
+    return frames, lines.count("D"), replies.count(b"#")
+
+
+def run_stream(binary, workdir, args):
+    ok = True
+    for name, chunks, expected, dumps in stream_cases():
+        frames, dumped, acks = stream_case(binary, chunks, STREAM_PIXELS)
+        passed = frames == expected and dumped == dumps and acks == len(frames)
+        print("  %-56s %d frame%s, %d dump%s%s" % (name, len(frames), "" if len(frames) == 1 else "s", dumped,
+                                                  "" if dumped == 1 else "s", "" if passed else "  FAIL"))
+        if not passed:
+            for got, want in zip(frames + ["-"] * len(expected), expected + ["-"] * len(frames)):
+                print("      got %s\n     want %s" % (got, want))
+        ok = ok and passed
+
+    # Each encoder's frames of the moving rainbow, each after the one before.
+    for encoding, encode in sorted(stream_sender.ENCODERS.items()):
+        frames = [stream_sender.rainbow(32, t * 0.25) for t in range(16)]
+        previous = None
+        chunks = []
+        for frame in frames:
+            chunks.append(encode(frame, previous))
+            previous = frame
+        got, dumped, acks = stream_case(binary, chunks, 32)
+        want = ["".join("%02x%02x%02x" % tuple(c >> 1 for c in p) for p in frame) for frame in frames]
+        passed = got == want and acks == len(frames)
+        print("  %-56s %d of %d frames right%s" % ("rainbow, " + encoding, sum(g == w for g, w in zip(got, want)),
+                                                 len(frames), "" if passed else "  FAIL"))
+        ok = ok and passed
+    return ok
+
+
+def run_default(binary, workdir, args):
+    return subprocess.call([binary] + (["--no-bench"] if args.no_bench else [])) == 0
+
+
+# name: (check source in tools/host, sketch sources it is built with, extra compiler flags, how to run it)
+CHECKS = {
+    "noise": ("noise_check.cpp", ["noise.cpp"], [], run_default),
+    "particles": ("particles_bench.cpp", ["particles.cpp", "noise.cpp"], ["-DPARTICLE_POOL_SIZE=64"], run_default),
+    "audio": ("audio_wav.cpp", ["audioAnalysis.cpp"], [], run_audio),
+    "buttons": ("button_check.cpp", ["buttonEvents.cpp"], [], run_default),
+    "charge": ("charge_sim.cpp", ["chargeControl.cpp"], [], run_default),
+    "stream": ("stream_unit.cpp", ["serialStream.cpp"], [], run_stream),
+    "sync": ("sync_unit.cpp", ["frameSync.cpp", "animationClock.cpp"], ["-DFRAME_SYNC=FRAME_SYNC_FOLLOWER"], run_sync),
+}
+
+
+def build(name, workdir, flags=None, binary=None):
+    """Build a check. flags and binary replace the table's flags and the check's name, for a second build."""
+    source, modules, table_flags, run = CHECKS[name]
+    flags = table_flags if flags is None else flags
+    binary = os.path.join(workdir, binary or name)
+    command = ["g++", "-std=gnu++98", "-O2", "-Wall", "-Wno-unused-parameter", "-DARDUINO=105"] + flags
+    command += ["-I", HOST, "-I", SKETCH, os.path.join(HOST, source), os.path.join(HOST, "host.cpp")]
+    command += [os.path.join(SKETCH, m) for m in modules]
+    command += ["-o", binary, "-lm"]
+    subprocess.check_call(command)
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("checks", nargs="*", help="checks to run: %s (default all)" % ", ".join(CHECKS))
+    parser.add_argument("--no-bench", action="store_true", help="skip the timings")
+    parser.add_argument("--wav", action="append", default=[], help="a recording for the audio check")
+    parser.add_argument("--trace", action="store_true", help="every block of --wav, not just the beats")
+    args = parser.parse_args()
+
+    names = args.checks or list(CHECKS)
+    for name in names:
+        if name not in CHECKS:
+            parser.error("no check called %s" % name)
+    if not shutil.which("g++"):
+        sys.exit("g++ is needed to build the checks")
+
+    failed = []
+    workdir = tempfile.mkdtemp(prefix="orion_checks_")
+    try:
+        for name in names:
+            print("== %s" % name)
+            sys.stdout.flush()
+            try:
+                binary = build(name, workdir)
+            except subprocess.CalledProcessError:
+                failed.append(name)
+                continue
+            if not CHECKS[name][3](binary, workdir, args):
+                failed.append(name)
+    finally:
+        shutil.rmtree(workdir)
+
+    print("%d of %d checks passed%s" % (len(names) - len(failed), len(names),
+                                         "; failed: " + ", ".join(failed) if failed else ""))
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
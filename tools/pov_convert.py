@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+"""Convert a bitmap into a POV image for the pov mode (see pov.h), and model the column rates the unit can reach.
+
+Each column of the bitmap becomes one column on the strip, played left to right. Rows are resampled to the
+strip's pixel count, and the bottom row goes to pixel 0, next to the controller (--top-first for the other way).
+
+    tools/pov_convert.py logo.ppm --rate 800 -o Synthesia_Orion/povData.h
+    tools/pov_convert.py photo.png --pixels 64 --brightness 0.5 -o Synthesia_Orion/povData.h
+    tools/pov_convert.py --demo -o Synthesia_Orion/povData.h
+    tools/pov_convert.py --timing
+
+Binary and text PPM and uncompressed 24/32 bit BMP are read directly. Anything else needs Pillow.
+
+Colours go through the same gamma table as the modes (gamma.cpp). The columns bypass the unit's power limiter,
+so the whole image is scaled down if its brightest column would draw more than --budget, from the same current
+model as powerLimiter.h. Scaling the image, not the columns, keeps it looking the same.
+
+--timing prints the column time and the highest column rate for 32 to 128 pixels at each SPI clock, from the
+cycle counts the firmware uses to cap the rate. The unit measures the real figures, with the column start jitter,
+in the energy profile's C lines (see energyProfile.h).
+"""
+
+import argparse
+import colorsys
+import os
+import re
+import struct
+import sys
+
+SKETCH = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Synthesia_Orion")
+
+VERSION = 1
+HEADER_SIZE = 9
+
+# pov.cpp
+OVERHEAD_CYCLES = 120
+BYTE_SLIP_CYCLES = 3
+MAX_LOAD_PERCENT = 75
+MAX_PERIOD_US = 32767
+
+
+def header_define(name, filename, default):
+    try:
+        with open(os.path.join(SKETCH, filename)) as f:
+            m = re.search(r"#define\s+%s\s+(\d+)" % name, f.read())
+        return int(m.group(1)) if m else default
+    except OSError:
+        return default
+
+
+def gamma_table():
+    try:
+        with open(os.path.join(SKETCH, "gamma.cpp")) as f:
+            body = f.read().split("{", 1)[1].split("}", 1)[0]
+        table = [int(x) for x in re.findall(r"\d+", body)]
+        if len(table) == 256:
+            return table
+    except (OSError, IndexError):
+        pass
+    return [int(127 * (x / 255.0) ** 2.5 + 0.5) for x in range(256)]
+
+
+def read_ppm(data):
+    tokens = []
+    i = 0
+    while len(tokens) < 4:
+        while data[i:i + 1].isspace():
+            i += 1
+        if data[i:i + 1] == b"#":
+            while data[i:i + 1] not in (b"\n", b""):
+                i += 1
+            continue
+        j = i
+        while not data[j:j + 1].isspace():
+            j += 1
+        tokens.append(data[i:j])
+        i = j
+    kind, width, height, maxval = tokens[0], int(tokens[1]), int(tokens[2]), int(tokens[3])
+    if kind == b"P6":
+        raw = data[i + 1:i + 1 + width * height * 3]
+        values = list(raw)
+    elif kind == b"P3":
+        values = [int(x) for x in data[i:].split()[:width * height * 3]]
+    else:
+        raise ValueError("only P3 and P6 PPM are read directly")
+    values = [v * 255 // maxval for v in values]
+    return width, height, [[tuple(values[(y * width + x) * 3:(y * width + x) * 3 + 3]) for x in range(width)]
+                           for y in range(height)]
+
+
+def read_bmp(data):
+    offset, = struct.unpack_from("<I", data, 10)
+    width, height, planes, bits, compression = struct.unpack_from("<iiHHI", data, 18)
+    if bits not in (24, 32) or compression not in (0, 3):
+        raise ValueError("only uncompressed 24 and 32 bit BMP are read directly")
+    step = bits // 8
+    stride = (width * step + 3) & ~3
+    rows = []
+    for y in range(abs(height)):
+        base = offset + y * stride
+        rows.append([(data[base + x * step + 2], data[base + x * step + 1], data[base + x * step])
+                     for x in range(width)])
+    if height > 0:
+        rows.reverse()  # Stored bottom up
+    return width, abs(height), rows
+
+
+def read_image(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:2] in (b"P3", b"P6"):
+        return read_ppm(data)
+    if data[:2] == b"BM":
+        return read_bmp(data)
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("%s: not PPM or BMP, and Pillow is not installed to read it" % path)
+    image = Image.open(path).convert("RGB")
+    width, height = image.size
+    pixels = list(image.getdata())
+    return width, height, [pixels[y * width:(y + 1) * width] for y in range(height)]
+
+
+def demo(pixels, columns):
+    """A rainbow arrow on black, pointing the way the belt is swept."""
+    rows = []
+    for y in range(pixels):
+        row = []
+        for x in range(columns):
+            middle = (pixels - 1) / 2.0
+            head = columns * 0.6
+            if x < head:
+                inside = abs(y - middle) < pixels / 8.0
+            else:
+                inside = abs(y - middle) < (columns - x) * pixels / 2.0 / (columns - head)
+            r, g, b = colorsys.hsv_to_rgb(x / float(columns), 1.0, 1.0) if inside else (0, 0, 0)
+            row.append((int(r * 255), int(g * 255), int(b * 255)))
+        rows.append(row)
+    return columns, pixels, rows
+
+
+def columns_for_strip(width, height, rows, pixels, top_first, brightness):
+    """Strip bytes per column: G R B with the high bit set, pixel 0 first."""
+    gamma = gamma_table()
+    columns = []
+    for x in range(width):
+        column = []
+        for n in range(pixels):
+            y = n * height // pixels
+            if not top_first:
+                y = height - 1 - y
+            r, g, b = rows[y][x]
+            for c in (g, r, b):
+                column.append(gamma[min(255, int(c * brightness + 0.5))])
+        columns.append(column)
+    return columns
+
+
+def column_ma(column, model):
+    pixels = len(column) // 3
+    return (pixels * model["idle_ua"] + sum(column) * model["unit_ua"]) / 1000.0
+
+
+def fit_budget(columns, model):
+    """Scale every value by the same amount so no column draws more than the budget."""
+    worst = max(column_ma(c, model) for c in columns)
+    if worst <= model["budget_ma"]:
+        return columns, 1.0
+    pixels = len(columns[0]) // 3
+    idle = pixels * model["idle_ua"] / 1000.0
+    scale = (model["budget_ma"] - idle) / (worst - idle)
+    return [[int(v * scale) for v in c] for c in columns], scale
+
+
+def column_us(pixels, divider):
+    latch = (pixels + 31) // 32
+    return ((pixels * 3 + latch) * (8 * divider + BYTE_SLIP_CYCLES) + OVERHEAD_CYCLES) / 16.0
+
+
+def rate_cap(pixels, divider, rate):
+    """The column rate the firmware actually uses for a requested rate, as in startPov()."""
+    period = 1000000 // rate
+    shortest = int(column_us(pixels, divider)) * 100 // MAX_LOAD_PERCENT
+    period = min(max(period, shortest), MAX_PERIOD_US)
+    return 1000000 // period
+
+
+def print_timing():
+    print("pixels\tSPI MHz\tcolumn us\tmax col/s\tcapped col/s\tms per 100 columns")
+    for pixels in (32, 64, 96, 128):
+        for divider in (2, 4, 8):
+            us = column_us(pixels, divider)
+            capped = rate_cap(pixels, divider, 65535)
+            print("%d\t%d\t%.1f\t\t%d\t\t%d\t\t%.0f" % (pixels, 16 // divider, us, 1000000 / us, capped,
+                                                          100000.0 / capped))
+
+
+def write_header(path, data, name, source):
+    lines = ["// Generated by tools/pov_convert.py from %s. Do not edit." % source,
+             "// %d bytes. Played by pov(), see pov.h." % len(data),
+             "",
+             "#ifndef __SYNTHESIA_POV_DATA_H",
+             "#define __SYNTHESIA_POV_DATA_H",
+             "",
+             "PROGMEM prog_uchar %s[] = {" % name]
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    lines += ["};", "", "#endif", "", "// End of file.", ""]
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("image", nargs="?", help="bitmap to convert")
+    parser.add_argument("--demo", action="store_true", help="convert a built in rainbow arrow instead")
+    parser.add_argument("--pixels", type=int, default=header_define("PIXEL_COUNT", "orion.h", 32))
+    parser.add_argument("--columns", type=int, default=48, help="columns for --demo")
+    parser.add_argument("--rate", type=int, default=500, help="columns per second, 31-65535")
+    parser.add_argument("--top-first", action="store_true", help="top row to pixel 0")
+    parser.add_argument("--brightness", type=float, default=1.0, help="scale before gamma, 0-1")
+    parser.add_argument("--budget", type=float, default=header_define("POWER_BUDGET_MA", "powerLimiter.h", 1500),
+                        help="strip current limit, mA")
+    parser.add_argument("--divider", type=int, default=header_define("POV_SPI_DIVIDER", "pov.h", 4),
+                        help="POV_SPI_DIVIDER the firmware is built with")
+    parser.add_argument("--name", default="__povImage", help="name of the PROGMEM array")
+    parser.add_argument("-o", "--output", help="header file to write")
+    parser.add_argument("--timing", action="store_true", help="print the column rate model and stop")
+    args = parser.parse_args()
+
+    if args.timing:
+        print_timing()
+        return
+    if args.demo:
+        width, height, rows = demo(args.pixels, args.columns)
+        source = "--demo --pixels %d --columns %d" % (args.pixels, args.columns)
+    elif args.image:
+        width, height, rows = read_image(args.image)
+        source = os.path.basename(args.image)
+    else:
+        parser.error("give an image, --demo or --timing")
+    if not 31 <= args.rate <= 65535:
+        parser.error("--rate must be 31-65535 columns per second")
+
+    model = {
+        "idle_ua": header_define("STRIP_IDLE_UA_PER_PIXEL", "powerLimiter.h", 1000),
+        "unit_ua": header_define("STRIP_UA_PER_UNIT", "powerLimiter.h", 38),
+        "budget_ma": args.budget,
+    }
+    columns = columns_for_strip(width, height, rows, args.pixels, args.top_first, args.brightness)
+    columns, scale = fit_budget(columns, model)
+
+    data = [ord("O"), ord("P"), VERSION, args.pixels & 0xFF, args.pixels >> 8, width & 0xFF, width >> 8,
+            args.rate & 0xFF, args.rate >> 8]
+    for column in columns:
+        data += [v | 0x80 for v in column]
+
+    rate = rate_cap(args.pixels, args.divider, args.rate)
+    currents = [column_ma(c, model) for c in columns]
+    print("%d columns of %d pixels, %d bytes of flash" % (width, args.pixels, len(data)))
+    print("current: average %.0f mA, brightest column %.0f mA%s" % (
+        sum(currents) / len(currents), max(currents),
+        ", scaled to %.0f%% to fit %.0f mA" % (scale * 100, args.budget) if scale < 1 else ""))
+    print("column %.1f us at %d MHz SPI; %d columns/s%s, image %.1f ms" % (
+        column_us(args.pixels, args.divider), 16 // args.divider, rate,
+        " (capped from %d)" % args.rate if rate < args.rate else "", width * 1000.0 / rate))
+
+    if args.output:
+        write_header(args.output, data, args.name, source)
+
+
+if __name__ == "__main__":
+    main()
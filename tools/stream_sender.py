@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""Stream frames to the unit over USB serial, and measure frame rate and round trip latency.
+
+The protocol is in serialStream.h: an Adalight header, then raw ('a'), run length ('r') or delta ('d') pixels.
+The unit answers '#' once each frame has been sent to the strip. The sender waits for that before the next frame,
+so the frame rate is the most the link and the unit can sustain, and the wait is the end to end latency.
+
+    tools/stream_sender.py --port /dev/ttyACM0 --pixels 32 --encoding delta --seconds 10
+    tools/stream_sender.py --loopback --pixels 32,64,128
+
+--loopback runs the same frames through a pseudo terminal into the unit's own parser instead, serialStream.cpp
+built for this machine as tools/host_checks.py stream builds it, to check the encoders and the harness without
+a unit. It needs g++. Its figures measure the host, not the belt. Talking to a real port needs pyserial.
+"""
+
+import argparse
+import colorsys
+import os
+import sys
+import threading
+import time
+
+ACK = b"#"
+
+
+def header(kind, pixels):
+    count = pixels - 1
+    hi, lo = count >> 8, count & 0xFF
+    return bytes([ord("A"), ord("d"), ord(kind), hi, lo, hi ^ lo ^ 0x55])
+
+
+def encode_raw(frame, previous):
+    return header("a", len(frame)) + b"".join(bytes(p) for p in frame)
+
+
+def encode_rle(frame, previous):
+    out = bytearray(header("r", len(frame)))
+    i = 0
+    while i < len(frame):
+        run = 1
+        while i + run < len(frame) and run < 255 and frame[i + run] == frame[i]:
+            run += 1
+        out += bytes([run]) + bytes(frame[i])
+        i += run
+    return bytes(out)
+
+
+def encode_delta(frame, previous):
+    if previous is None or len(previous) != len(frame):
+        previous = [None] * len(frame)
+    out = bytearray(header("d", len(frame)))
+    i = 0
+    while i < len(frame):
+        skip = 0
+        while i + skip < len(frame) and skip < 255 and frame[i + skip] == previous[i + skip]:
+            skip += 1
+        out.append(skip)
+        i += skip
+        if i >= len(frame):
+            break
+        span = 0
+        while i + span < len(frame) and span < 255 and frame[i + span] != previous[i + span]:
+            span += 1
+        out.append(span)
+        for p in frame[i:i + span]:
+            out += bytes(p)
+        i += span
+    return bytes(out)
+
+
+ENCODERS = {"raw": encode_raw, "rle": encode_rle, "delta": encode_delta}
+
+
+def rainbow(pixels, t):
+    """A slowly moving rainbow with a dark gap, so RLE and delta both have something to gain."""
+    frame = []
+    for i in range(pixels):
+        if (i + int(t * 8)) % pixels < pixels // 4:
+            frame.append((0, 0, 0))
+        else:
+            r, g, b = colorsys.hsv_to_rgb((i / float(pixels) + t * 0.1) % 1.0, 1.0, 1.0)
+            frame.append((int(r * 255), int(g * 255), int(b * 255)))
+    return frame
+
+
+def loopback_link(pixels, unit_binary):
+    """A pty pair with the unit's own parser, built for the host, on the far end. Returns (write, read_ack,
+    last_frame, stop): last_frame() is the strip after the last frame the unit showed."""
+    import pty
+    import subprocess
+    import tty
+    host, unit_end = pty.openpty()
+    tty.setraw(host)
+    tty.setraw(unit_end)
+    unit = subprocess.Popen([unit_binary, "--fd", str(unit_end), "--pixels", str(pixels)], pass_fds=[unit_end],
+                            stdout=subprocess.PIPE)
+    os.close(unit_end)
+    shown = [None]
+
+    def watch():
+        for line in unit.stdout:
+            fields = line.split()
+            if fields[:1] == [b"F"]:
+                shown[0] = fields[2].decode()
+
+    thread = threading.Thread(target=watch)
+    thread.daemon = True
+    thread.start()
+
+    def stop():
+        os.close(host)
+        unit.wait()
+        thread.join()
+
+    return (lambda data: os.write(host, data)), (lambda: os.read(host, 1) == ACK), (lambda: shown[0]), stop
+
+
+def serial_link(port):
+    import serial
+    link = serial.Serial(port, 115200, timeout=1)
+    return link.write, (lambda: link.read(1) == ACK), None, link.close
+
+
+def run(args, pixels, unit_binary):
+    if unit_binary:
+        write, read_ack, last_frame, stop = loopback_link(pixels, unit_binary)
+    else:
+        write, read_ack, last_frame, stop = serial_link(args.port)
+
+    encode = ENCODERS[args.encoding]
+    previous = None
+    frames = lost = sent_bytes = 0
+    latencies = []
+    start = time.time()
+    try:
+        while time.time() - start < args.seconds:
+            frame = rainbow(pixels, time.time() - start)
+            data = encode(frame, previous)
+            sent = time.time()
+            write(data)
+            if read_ack():
+                latencies.append(time.time() - sent)
+                frames += 1
+            else:
+                lost += 1
+            sent_bytes += len(data)
+            previous = frame
+    finally:
+        stop()
+
+    elapsed = time.time() - start
+    if last_frame is not None and frames and \
+            last_frame() != "".join("%02x%02x%02x" % tuple(c >> 1 for c in p) for p in previous):
+        print("%d px: the unit's pixels do not match the last frame sent" % pixels, file=sys.stderr)
+    if not latencies:
+        print("%d px: no frames acknowledged" % pixels)
+        return
+    latencies.sort()
+    print("%d px %s: %.1f fps, %.0f bytes/frame, latency %.2f ms median, %.2f ms worst, %d lost"
+          % (pixels, args.encoding, frames / elapsed, sent_bytes / float(frames + lost),
+             latencies[len(latencies) // 2] * 1000, latencies[-1] * 1000, lost))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--port", help="the unit's USB serial port")
+    parser.add_argument("--loopback", action="store_true", help="stream to the parser built for the host, over a pty")
+    parser.add_argument("--pixels", default="32", help="pixel counts, comma separated, one run each")
+    parser.add_argument("--encoding", choices=sorted(ENCODERS), default="raw")
+    parser.add_argument("--seconds", type=float, default=5.0, help="length of each run")
+    args = parser.parse_args()
+    if not args.port and not args.loopback:
+        parser.error("give --port or --loopback")
+
+    workdir = None
+    unit_binary = None
+    if args.loopback:
+        import shutil
+        import tempfile
+        import host_checks
+        workdir = tempfile.mkdtemp(prefix="orion_stream_")
+        unit_binary = host_checks.build("stream", workdir)
+    try:
+        for pixels in (int(x) for x in args.pixels.split(",")):
+            run(args, pixels, unit_binary)
+    finally:
+        if workdir:
+            shutil.rmtree(workdir)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Decode a telemetry log dump from the unit.
+
+Open the USB serial port, send "dump" and save what comes back, then:
+
+    tools/telemetry_decode.py dump.txt
+
+Each "T <slot> <hex>" line is one TelemetryRecord (see telemetryLog.h), oldest first. Records are
+TELEMETRY_LOG_PERIOD seconds apart, so the age column counts back from the newest.
+"""
+
+import os
+import re
+import sys
+
+SKETCH = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Synthesia_Orion")
+
+CHARGE_PHASES = ["unplugged", "settling", "fast", "limited", "topping", "full"]
+
+
+def header_define(name, path, default):
+    try:
+        with open(path) as f:
+            m = re.search(r"#define\s+%s\s+(\d+)" % name, f.read())
+        return int(m.group(1)) if m else default
+    except OSError:
+        return default
+
+
+def mode_names():
+    """Frame function of each mode, in mode button order, from the default list in modeList.h."""
+    try:
+        with open(os.path.join(SKETCH, "modeList.h")) as f:
+            return re.findall(r"^\s*MODE\((\w+),", f.read(), re.M)
+    except OSError:
+        return []
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit("usage: %s dump.txt|-" % sys.argv[0])
+    period = header_define("TELEMETRY_LOG_PERIOD", os.path.join(SKETCH, "telemetryLog.h"), 300)
+    names = mode_names()
+
+    records = []
+    f = sys.stdin if sys.argv[1] == "-" else open(sys.argv[1])
+    for line in f:
+        fields = line.split()
+        if len(fields) != 3 or fields[0] != "T" or len(fields[2]) != 16:
+            continue
+        records.append(bytes.fromhex(fields[2]))
+    if not records:
+        sys.exit("no telemetry records in %s" % sys.argv[1])
+
+    print("\t".join(["seq", "age", "mode", "speed", "bright", "battery", "fps", "misses", "limiter",
+                     "power", "usb", "reduced", "charge"]))
+    for i, r in enumerate(records):
+        sequence, mode, settings, battery, fps, misses, limiter, flags = r
+        age = (len(records) - 1 - i) * period
+        phase = flags >> 5
+        print("\t".join([
+            str(sequence),
+            "-%d:%02d" % (age // 3600, age // 60 % 60),
+            names[mode] if mode < len(names) else str(mode),
+            str(settings >> 4),
+            str(settings & 0x0F),
+            "%.2f V" % (battery * 0.02) if battery else "-",
+            str(fps),
+            str(misses) + ("+" if misses == 255 else ""),
+            "off" if limiter == 255 else "%d%%" % (limiter * 100 // 256),
+            "on" if flags & 0x01 else "off",
+            "yes" if flags & 0x02 else "no",
+            "yes" if flags & 0x04 else "no",
+            CHARGE_PHASES[phase] if phase < len(CHARGE_PHASES) else str(phase),
+        ]))
+
+
+if __name__ == "__main__":
+    main()